@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+#include "src/Farm.h"
+#include "src/Machine.h"
+#include "src/TextScreen.h"
+#include "src/Typist.h"
+
+// Runs every file in a directory as a job on a machine of its own, in
+// parallel. One machine boots to the BASIC prompt and every job starts from
+// a copy-on-write fork of it. A .bas file is typed in as a program and RUN;
+// any other file is typed as it is. A job is done when BASIC shows Ok again
+// after reading all of its input, and ends early when it has run the
+// instructions allowed by --max-instructions or the emulated time allowed
+// by --max-seconds.
+//
+// Results are JSON Lines, one object per job in file name order:
+//
+//   {"job": "name.bas", "reason": "done", "instructions": 1234,
+//    "emulated_seconds": 0.5, "wall_seconds": 0.01, "screen": "..."}
+//
+// The reason is done, instructions, time or stopped (halted with interrupts
+// disabled). Exit status is 0 if every job is done, 2 if any other reason
+// ended one and 1 on errors.
+
+static const char USAGE[] =
+    "usage: batch [--bios PATH] [--basic PATH] [--jobs N] [--max-instructions N] [--max-seconds S]\n"
+    "             [--out PATH|-] DIR\n";
+
+// Emulated time allowed for the BASIC prompt to come up, in milliseconds.
+static const int BOOT_MS = 30000;
+
+struct Job
+{
+    std::string                 name;
+    std::string                 input;
+    std::unique_ptr<Machine>    machine;
+    std::unique_ptr<TextScreen> screen;
+    std::unique_ptr<Typist>     typist;
+    size_t                      typed    = 0;
+    long long                   deadline = 0;    // PIT tick
+    uint64_t                    changes  = 0;    // screen changes at the last look
+    const char                 *reason   = nullptr;
+};
+
+static std::string readInput(const std::string &path, bool program)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error(path + ": cannot open");
+    }
+    std::stringstream contents;
+    contents << in.rdbuf();
+
+    std::string input;
+    for (char c : contents.str()) {
+        if (c == '\r') {
+            continue;
+        }
+        if ((c < 0x20 || c > 0x7e) && c != '\n' && c != '\t' && c != '\b' && c != 0x1b) {
+            throw std::runtime_error(path + ": no key types character " + std::to_string((uint8_t)c));
+        }
+        input += c;
+    }
+    if (!input.empty() && input.back() != '\n') {
+        input += '\n';
+    }
+    if (program) {
+        input += "RUN\n";
+    }
+    return input;
+}
+static std::vector<std::string> listFiles(const std::string &dir)
+{
+    DIR *handle = opendir(dir.c_str());
+    if (handle == nullptr) {
+        throw std::runtime_error(dir + ": cannot open directory");
+    }
+    std::vector<std::string> names;
+    while (const dirent *entry = readdir(handle)) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        struct stat info;
+        if (stat((dir + "/" + entry->d_name).c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+            names.push_back(entry->d_name);
+        }
+    }
+    closedir(handle);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+static bool endsWith(const std::string &text, const char *suffix)
+{
+    const size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+// BASIC shows Ok on the line above the cursor, and nothing on screen moved
+// during the last quantum.
+static bool finished(Job &job)
+{
+    const uint64_t changes = job.screen->changes();
+    const bool     quiet   = changes == job.changes;
+    job.changes            = changes;
+    if (!quiet) {
+        return false;
+    }
+    const int cursor = job.screen->cursor();
+    const int row    = cursor < 0 ? 0 : cursor / job.screen->columns();
+    if (row == 0) {
+        return false;
+    }
+    const std::string &text  = job.screen->text();
+    size_t             start = 0;
+    for (int i = 0; i < row - 1; ++i) {
+        start = text.find('\n', start) + 1;
+    }
+    return text.compare(start, 3, "Ok ") == 0 || text.compare(start, 3, "Ok\n") == 0;
+}
+static bool proceed(Job &job)
+{
+    if (job.typed < job.input.size()) {
+        job.typed = job.typist->feed(job.input, job.typed);
+        job.screen->changes();
+    } else if (job.typist->drained() && finished(job)) {
+        job.reason = "done";
+        return false;
+    }
+    if (job.machine->ticks() >= job.deadline) {
+        job.reason = "time";
+        return false;
+    }
+    return true;
+}
+static std::string quote(const std::string &text)
+{
+    std::string out = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            default:
+                if ((uint8_t)c < 0x20) {
+                    char escape[8];
+                    snprintf(escape, sizeof(escape), "\\u%04x", c);
+                    out += escape;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out + "\"";
+}
+// The screen without blanks at the end of lines, or blank lines at the end.
+static std::string trimScreen(const std::string &text)
+{
+    std::string out;
+    size_t      start = 0;
+    while (start < text.size()) {
+        size_t end  = text.find('\n', start);
+        end         = end == std::string::npos ? text.size() : end;
+        size_t last = end;
+        while (last > start && text[last - 1] == ' ') {
+            --last;
+        }
+        out.append(text, start, last - start);
+        out += '\n';
+        start = end + 1;
+    }
+    while (out.size() >= 2 && out[out.size() - 1] == '\n' && out[out.size() - 2] == '\n') {
+        out.pop_back();
+    }
+    return out;
+}
+int main(int ArgCount, char **Args)
+{
+    Machine::Config config;
+    std::string     dir;
+    std::string     out_path = "-";
+    int             workers  = 0;
+    long long       budget   = LLONG_MAX;
+    double          seconds  = 60;
+    try {
+        for (int i = 1; i < ArgCount; ++i) {
+            const bool more = i + 1 < ArgCount;
+            if (strcmp(Args[i], "--bios") == 0 && more) {
+                config.bios = Args[++i];
+            } else if (strcmp(Args[i], "--basic") == 0 && more) {
+                config.basic = Args[++i];
+            } else if (strcmp(Args[i], "--jobs") == 0 && more) {
+                workers = atoi(Args[++i]);
+            } else if (strcmp(Args[i], "--max-instructions") == 0 && more) {
+                budget = atoll(Args[++i]);
+            } else if (strcmp(Args[i], "--max-seconds") == 0 && more) {
+                seconds = atof(Args[++i]);
+            } else if (strcmp(Args[i], "--out") == 0 && more) {
+                out_path = Args[++i];
+            } else if (Args[i][0] != '-' && dir.empty()) {
+                dir = Args[i];
+            } else {
+                fputs(USAGE, stderr);
+                return EXIT_FAILURE;
+            }
+        }
+        if (dir.empty() || config.basic.empty()) {
+            fputs(USAGE, stderr);
+            return EXIT_FAILURE;
+        }
+
+        // Boot once; the jobs share its memory until they write to it, so
+        // it does not run again and is declared first to outlive them.
+        Machine    base(config);
+        TextScreen prompt(base.cpu());
+
+        std::vector<std::unique_ptr<Job>> jobs;
+        for (const std::string &name : listFiles(dir)) {
+            std::unique_ptr<Job> job(new Job());
+            job->name  = name;
+            job->input = readInput(dir + "/" + name, endsWith(name, ".bas") || endsWith(name, ".BAS"));
+            jobs.push_back(std::move(job));
+        }
+
+        if (!prompt.wait_for_text("Ok", TextScreen::Region{}, BOOT_MS)) {
+            throw std::runtime_error("BASIC did not come up");
+        }
+
+        Farm farm(workers);
+        for (auto &job : jobs) {
+            Job *j        = job.get();
+            j->machine    = base.fork();
+            j->screen.reset(new TextScreen(j->machine->cpu()));
+            j->typist.reset(new Typist(j->machine->cpu()));
+            j->deadline   = base.ticks() + (long long)(seconds * Intel8086::PIT_HZ);
+            farm.add(j->machine.get(), [j](Machine &) { return proceed(*j); }, budget);
+        }
+        farm.run();
+
+        FILE *out = out_path == "-" ? stdout : fopen(out_path.c_str(), "wb");
+        if (out == nullptr) {
+            throw std::runtime_error(out_path + ": cannot create");
+        }
+        int done = 0;
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            Job        &job    = *jobs[i];
+            const char *reason = job.reason;
+            switch (farm.status((int)i)) {
+                case Farm::STATUS_BUDGET:
+                    reason = "instructions";
+                    break;
+                case Farm::STATUS_STOPPED:
+                    reason = "stopped";
+                    break;
+                default:
+                    break;
+            }
+            done += strcmp(reason, "done") == 0;
+            const Farm::Stats stats = farm.stats((int)i);
+            fprintf(out,
+                    "{\"job\": %s, \"reason\": \"%s\", \"instructions\": %lld, \"emulated_seconds\": %.6f, "
+                    "\"wall_seconds\": %.6f, \"screen\": %s}\n",
+                    quote(job.name).c_str(), reason, stats.instructions,
+                    (double)(job.machine->ticks() - base.ticks()) / Intel8086::PIT_HZ, stats.seconds,
+                    quote(trimScreen(job.screen->text())).c_str());
+        }
+        if (out != stdout) {
+            fclose(out);
+        }
+
+        const Farm::Stats total = farm.total();
+        fprintf(stderr, "batch: %d of %d jobs done in %.2f s, %.1f MIPS\n", done, (int)jobs.size(), total.seconds,
+                total.mips);
+        return done == (int)jobs.size() ? EXIT_SUCCESS : 2;
+    } catch (const std::exception &e) {
+        fprintf(stderr, "batch: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+}
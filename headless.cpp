@@ -0,0 +1,315 @@
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "src/Arena.h"
+#include "src/HostControl.h"
+#include "src/Intel8086.h"
+#include "src/Rasterizer.h"
+#include "src/TextScreen.h"
+#include "src/Typist.h"
+
+// Runs a machine without a display. Actions run in command line order:
+//
+//   --wait TEXT        run until TEXT is on screen
+//   --type TEXT        type TEXT, with \n, \t and \\ escapes
+//   --type-file PATH   type the contents of a file
+//
+// The run ends after the last action, or when the budget set with --cycles
+// (instructions) or --seconds (emulated time) is spent; without either, the
+// actions get a minute of emulated time. Exit status is 0 if every action
+// completed, 2 if the budget ran out first and 1 on errors. Unless an earlier
+// --wait did, the first --type waits for the BASIC prompt.
+//
+// --host-io maps the HostControl device, so the guest can time regions,
+// write to stdout and end the run with an exit status of its own.
+//
+// --bench N boots N machines instead, starts a BASIC loop on each and runs
+// them interleaved on this thread, one millisecond of emulated time each in
+// turn, for --seconds of emulated time (10 by default). It reports MIPS and
+// whether guest RAM got huge pages; run it under perf stat with and without
+// CPU8086_HUGEPAGES=0 to compare dTLB misses.
+
+static const char USAGE[] =
+    "usage: headless [--bios PATH] [--basic PATH|--no-basic] [--cycles N] [--seconds S]\n"
+    "                [--accurate-keys] [--wait TEXT] [--type TEXT] [--type-file PATH]...\n"
+    "                [--screen PATH|-] [--capture PATH.ppm] [--host-io]\n"
+    "       headless [--bios PATH] [--basic PATH] [--seconds S] --bench N\n";
+
+// Slice of emulated time between two budget checks, in milliseconds.
+static const int SLICE_MS = 10;
+
+// Emulated time allowed when neither --cycles nor --seconds is given.
+static const long long DEFAULT_SECONDS = 60;
+
+struct Action
+{
+    enum
+    {
+        WAIT,
+        TYPE,
+    } type;
+    std::string text;
+};
+
+// Thrown from the HostControl exit callback to leave the run.
+struct ExitRequest
+{
+    int status;
+};
+
+struct Budget
+{
+    long long ticks  = LLONG_MAX;
+    long long cycles = LLONG_MAX;
+
+    bool spent(Intel8086 *cpu)
+    {
+        return cpu->get_ticks() >= ticks || cpu->get_cycles() >= cycles;
+    }
+};
+
+static std::string unescape(const char *text)
+{
+    std::string out;
+    for (const char *p = text; *p; ++p) {
+        if (*p != '\\' || p[1] == 0) {
+            out += *p;
+            continue;
+        }
+        switch (*++p) {
+            case 'n':
+                out += '\n';
+                break;
+            case 't':
+                out += '\t';
+                break;
+            default:
+                out += *p;
+        }
+    }
+    return out;
+}
+static std::string readFile(const char *path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error(std::string(path) + ": cannot open");
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+static bool waitFor(Intel8086 *cpu, TextScreen &screen, const std::string &text, Budget &budget)
+{
+    while (!budget.spent(cpu)) {
+        if (screen.wait_for_text(text, TextScreen::Region{}, SLICE_MS)) {
+            return true;
+        }
+    }
+    return false;
+}
+static bool typeText(Intel8086 *cpu, Typist &typist, const std::string &text, Typist::Mode mode, Budget &budget)
+{
+    // One line at a time, so a long file stops at the budget.
+    size_t start = 0;
+    while (start < text.size()) {
+        if (budget.spent(cpu)) {
+            return false;
+        }
+        size_t end = text.find('\n', start);
+        end        = end == std::string::npos ? text.size() : end + 1;
+        if (!typist.type(text.substr(start, end - start), mode)) {
+            return false;
+        }
+        start = end;
+    }
+    return true;
+}
+static int bench(int count, const std::string &bios, const std::string &basic, long long ticks)
+{
+    // Integer and floating point work over an array, so each machine keeps
+    // some RAM of its own busy.
+    static const char PROGRAM[] = "10 DIM A(2000)\n"
+                                  "20 FOR I=0 TO 2000: A(I)=A(I)+I*1.5: NEXT: GOTO 20\n"
+                                  "RUN\n";
+    static const long long SLICE_TICKS = Intel8086::PIT_HZ / 1000;
+
+    std::vector<std::unique_ptr<Intel8086>> cpus;
+    for (int i = 0; i < count; ++i) {
+        cpus.emplace_back(new Intel8086());
+        cpus.back()->init(bios, basic);
+        TextScreen screen(cpus.back().get());
+        Typist     typist(cpus.back().get());
+        if (!screen.wait_for_text("Ok") || !typist.type(PROGRAM)) {
+            throw std::runtime_error("bench: BASIC did not come up");
+        }
+    }
+
+    long long instructions = 0;
+    long long resident     = 0;
+    for (auto &cpu : cpus) {
+        instructions -= cpu->get_cycles();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (long long done = 0; done < ticks; done += SLICE_TICKS) {
+        for (auto &cpu : cpus) {
+            cpu->run_until(cpu->get_ticks() + SLICE_TICKS);
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (auto &cpu : cpus) {
+        instructions += cpu->get_cycles();
+        resident += cpu->resident_pages();
+    }
+
+    Arena &arena = Arena::shared();
+    printf("bench: %d machines, %lld instructions in %.3f s, %.2f MIPS\n", count, instructions, seconds,
+           instructions / seconds / 1e6);
+    printf("bench: %lld KB of guest RAM, huge pages %s, %zu of %zu arena chunks advised\n",
+           resident * Intel8086::PAGE_SIZE / 1024, arena.huge_pages() ? "on" : "off", arena.huge_chunks(),
+           arena.chunks());
+    return EXIT_SUCCESS;
+}
+int main(int ArgCount, char **Args)
+{
+    std::string         bios  = "bin/bios.bin";
+    std::string         basic = "bin/basic.bin";
+    std::string         screen_path;
+    std::string         capture_path;
+    std::vector<Action> actions;
+    Budget              budget;
+    bool                limited  = false;
+    Typist::Mode        mode     = Typist::MODE_HLE;
+    bool                host_io  = false;
+    int                 machines = 0;
+    try {
+        for (int i = 1; i < ArgCount; ++i) {
+            const bool more = i + 1 < ArgCount;
+            if (strcmp(Args[i], "--bios") == 0 && more) {
+                bios = Args[++i];
+            } else if (strcmp(Args[i], "--basic") == 0 && more) {
+                basic = Args[++i];
+            } else if (strcmp(Args[i], "--no-basic") == 0) {
+                basic.clear();
+            } else if (strcmp(Args[i], "--cycles") == 0 && more) {
+                budget.cycles = atoll(Args[++i]);
+                limited       = true;
+            } else if (strcmp(Args[i], "--seconds") == 0 && more) {
+                budget.ticks = (long long)(atof(Args[++i]) * Intel8086::PIT_HZ);
+                limited      = true;
+            } else if (strcmp(Args[i], "--accurate-keys") == 0) {
+                mode = Typist::MODE_ACCURATE;
+            } else if (strcmp(Args[i], "--wait") == 0 && more) {
+                actions.push_back({Action::WAIT, unescape(Args[++i])});
+            } else if (strcmp(Args[i], "--type") == 0 && more) {
+                actions.push_back({Action::TYPE, unescape(Args[++i])});
+            } else if (strcmp(Args[i], "--type-file") == 0 && more) {
+                actions.push_back({Action::TYPE, readFile(Args[++i])});
+            } else if (strcmp(Args[i], "--screen") == 0 && more) {
+                screen_path = Args[++i];
+            } else if (strcmp(Args[i], "--capture") == 0 && more) {
+                capture_path = Args[++i];
+            } else if (strcmp(Args[i], "--host-io") == 0) {
+                host_io = true;
+            } else if (strcmp(Args[i], "--bench") == 0 && more) {
+                machines = atoi(Args[++i]);
+            } else {
+                fputs(USAGE, stderr);
+                return EXIT_FAILURE;
+            }
+        }
+        if (machines > 0) {
+            if (basic.empty()) {
+                throw std::runtime_error("--bench needs BASIC");
+            }
+            return bench(machines, bios, basic, budget.ticks == LLONG_MAX ? 10LL * Intel8086::PIT_HZ : budget.ticks);
+        }
+        if (actions.empty() && !limited) {
+            // Nothing to wait for: boot to the BASIC prompt, or run for the
+            // default budget without BASIC.
+            if (basic.empty()) {
+                budget.ticks = DEFAULT_SECONDS * Intel8086::PIT_HZ;
+                limited      = true;
+            } else {
+                actions.push_back({Action::WAIT, "Ok"});
+            }
+        }
+        if (!limited) {
+            // Text that never shows up ends the run instead of hanging it.
+            budget.ticks = DEFAULT_SECONDS * Intel8086::PIT_HZ;
+        }
+
+        std::unique_ptr<Intel8086> cpu(new Intel8086());
+        cpu->init(bios, basic);
+        TextScreen screen(cpu.get());
+        Typist     typist(cpu.get());
+
+        std::unique_ptr<HostControl> host;
+        if (host_io) {
+            host.reset(new HostControl(cpu.get(), [](int status) { throw ExitRequest{status}; }));
+            cpu->map_ports(host.get(), HostControl::PORT_FIRST, HostControl::PORT_LAST);
+        }
+
+        bool completed = true;
+        int  status    = -1;
+        try {
+            bool waited = false;
+            for (const Action &action : actions) {
+                if (action.type == Action::TYPE && !waited && !basic.empty()) {
+                    // BASIC empties the keyboard buffer when it starts.
+                    completed = waitFor(cpu.get(), screen, "Ok", budget);
+                    waited    = true;
+                    if (!completed) {
+                        fprintf(stderr, "headless: budget spent before seeing the BASIC prompt\n");
+                        break;
+                    }
+                }
+                waited    = waited || action.type == Action::WAIT;
+                completed = action.type == Action::WAIT ? waitFor(cpu.get(), screen, action.text, budget)
+                                                        : typeText(cpu.get(), typist, action.text, mode, budget);
+                if (!completed) {
+                    fprintf(stderr, "headless: budget spent before %s \"%s\"\n",
+                            action.type == Action::WAIT ? "seeing" : "typing", action.text.c_str());
+                    break;
+                }
+            }
+            if (completed && limited) {
+                cpu->run_until(budget.ticks, budget.cycles);
+            }
+        } catch (const ExitRequest &request) {
+            status = request.status;
+        }
+
+        if (!screen_path.empty()) {
+            FILE *out = screen_path == "-" ? stdout : fopen(screen_path.c_str(), "wb");
+            if (out == nullptr) {
+                throw std::runtime_error(screen_path + ": cannot create");
+            }
+            fputs(screen.text().c_str(), out);
+            if (out != stdout) {
+                fclose(out);
+            }
+        }
+        if (!capture_path.empty()) {
+            std::unique_ptr<VideoFrame> frame(new VideoFrame());
+            frame->capture(cpu.get());
+            Rasterizer raster(CGA_FONT_8X8);
+            raster.draw(*frame);
+            raster.save_ppm(capture_path);
+        }
+        if (status >= 0) {
+            return status;
+        }
+        return completed ? EXIT_SUCCESS : 2;
+    } catch (const std::exception &e) {
+        fprintf(stderr, "headless: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+}
@@ -3,38 +3,92 @@
 
 #include <SDL2/SDL.h>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include "src/PC.h"
 #include <time.h>
+#include <atomic>
 #include <thread>
 
-uint32_t Running = 1;
-
-void render_loop(PC *pc, SDL_Renderer *render, int width, int height)
+// The emulator runs on its own thread; apart from posting frame events, all
+// SDL calls stay on the main thread.
+void cpu_loop(PC *pc, const std::atomic<bool> *running)
 {
-    while (Running) {
-        pc->paint(render, width, height);
+    while (*running) {
+        pc->run_cpu();
     }
 }
 int main(int ArgCount, char **Args)
 {
-    static const int width = 560, height = 300;
-    PC              *pc = new PC();
-    SDL_Window      *window =
+    PC *pc = nullptr;
+    try {
+        pc = new PC();
+    } catch (const std::exception &e) {
+        printf("error: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+    Uint32            flags = SDL_RENDERER_ACCELERATED;
+    bool              stats = false;
+    std::atomic<bool> running{true};
+    std::atomic<int>  status{0};
+    for (int i = 1; i < ArgCount; ++i) {
+        if (strcmp(Args[i], "--software") == 0) {
+            pc->use_software_renderer(true);
+        } else if (strcmp(Args[i], "--font8x8") == 0) {
+            pc->set_font(CGA_FONT_8X8);
+        } else if (strcmp(Args[i], "--vsync") == 0) {
+            flags |= SDL_RENDERER_PRESENTVSYNC;
+        } else if (strcmp(Args[i], "--max-fps") == 0 && i + 1 < ArgCount) {
+            pc->set_max_fps(atoi(Args[++i]));
+        } else if (strcmp(Args[i], "--speed") == 0 && i + 1 < ArgCount) {
+            pc->set_speed(atof(Args[++i]));
+        } else if (strcmp(Args[i], "--unlimited") == 0) {
+            pc->set_speed(0);
+        } else if (strcmp(Args[i], "--stats") == 0) {
+            stats = true;
+        } else if (strcmp(Args[i], "--host-io") == 0) {
+            // The guest may end the session; wake the UI thread so it sees it.
+            pc->enable_host_control([&](int code) {
+                status  = code;
+                running = false;
+                SDL_Event quit{};
+                quit.type = SDL_QUIT;
+                SDL_PushEvent(&quit);
+            });
+        }
+    }
+    const int     width  = pc->screen_width();
+    const int     height = pc->screen_height();
+    SDL_Window   *window =
         SDL_CreateWindow("", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, SDL_WINDOW_OPENGL);
-    SDL_Renderer *render = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    SDL_Renderer *render = SDL_CreateRenderer(window, -1, flags);
     SDL_RenderSetScale(render, 1, 1);
 
-    std::thread th(render_loop, pc, render, width, height);
+    std::thread th(cpu_loop, pc, &running);
 
-    while (Running) {
-        pc->run_cpu();
+    // Sleep until there is input or a new frame; a static screen costs
+    // nothing.
+    int wait = -1;
+    while (running) {
         SDL_Event Event;
-        while (SDL_PollEvent(&Event)) {
+        int       got = wait < 0 ? SDL_WaitEvent(&Event) : SDL_WaitEventTimeout(&Event, wait);
+        while (got) {
             if (Event.type == SDL_QUIT)
-                Running = 0;
+                running = false;
+            if (Event.type == SDL_WINDOWEVENT && Event.window.event == SDL_WINDOWEVENT_EXPOSED)
+                pc->repaint();
+            if (Event.type == SDL_KEYDOWN || Event.type == SDL_KEYUP)
+                pc->key_event(Event.key);
+            got = SDL_PollEvent(&Event);
         }
+        wait = pc->paint(render, width, height);
     }
 
     th.join();
-    return 0;
+    if (stats) {
+        const Throttle::Stats st = pc->speed_stats();
+        printf("%.2f s emulated in %.2f s (%.3fx), lag %.2f ms, worst %.2f ms, %lld sleeps, %lld resyncs\n",
+               st.guest_seconds, st.host_seconds, st.speed, st.lag_ms, st.worst_lag_ms, st.sleeps, st.resyncs);
+    }
+    return status;
 }
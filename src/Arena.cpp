@@ -0,0 +1,97 @@
+#include "Arena.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+Arena::Arena(bool huge_pages) : m_huge_pages(huge_pages)
+{
+}
+Arena::~Arena()
+{
+    for (size_t i = 0; i < m_chunks.size(); ++i) {
+#ifdef _WIN32
+        VirtualFree(m_chunks[i], 0, MEM_RELEASE);
+#else
+        munmap(m_chunks[i], m_sizes[i]);
+#endif
+    }
+}
+Arena &Arena::shared()
+{
+    static Arena arena([] {
+        const char *env = getenv("CPU8086_HUGEPAGES");
+        return env == nullptr || strcmp(env, "0") != 0;
+    }());
+    return arena;
+}
+void *Arena::allocate(size_t size, size_t align)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if (size > CHUNK_SIZE) {
+        return allocateChunk((size + CHUNK_SIZE - 1) & ~(CHUNK_SIZE - 1));
+    }
+    uintptr_t next = ((uintptr_t)m_next + align - 1) & ~(uintptr_t)(align - 1);
+    if (m_next == nullptr || next + size > (uintptr_t)m_end) {
+        m_next = (uint8_t *)allocateChunk(CHUNK_SIZE);
+        m_end  = m_next + CHUNK_SIZE;
+        next   = (uintptr_t)m_next;
+    }
+    m_next = (uint8_t *)(next + size);
+    return (void *)next;
+}
+void *Arena::allocateChunk(size_t size)
+{
+#ifdef _WIN32
+    // Large pages need SeLockMemoryPrivilege; use normal pages.
+    void *chunk = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (chunk == NULL) {
+        throw std::bad_alloc();
+    }
+#else
+    // Over-allocate so the chunk can be trimmed to a 2 MiB boundary, which
+    // is what lets the kernel back it with a single huge page.
+    size_t length = size + CHUNK_SIZE;
+    void  *raw    = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    uintptr_t start = ((uintptr_t)raw + CHUNK_SIZE - 1) & ~(uintptr_t)(CHUNK_SIZE - 1);
+    uintptr_t end   = start + size;
+    if (start > (uintptr_t)raw) {
+        munmap(raw, start - (uintptr_t)raw);
+    }
+    if ((uintptr_t)raw + length > end) {
+        munmap((void *)end, (uintptr_t)raw + length - end);
+    }
+    void *chunk = (void *)start;
+#ifdef MADV_HUGEPAGE
+    if (m_huge_pages && madvise(chunk, size, MADV_HUGEPAGE) == 0) {
+        ++m_huge_chunks;
+    }
+#endif
+#endif
+    m_chunks.push_back(chunk);
+    m_sizes.push_back(size);
+    return chunk;
+}
+bool Arena::huge_pages()
+{
+    return m_huge_pages;
+}
+size_t Arena::chunks()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_chunks.size();
+}
+size_t Arena::huge_chunks()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_huge_chunks;
+}
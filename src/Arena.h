@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Bump allocator over 2 MiB aligned chunks, released only when the arena is.
+// Requests larger than a chunk get chunks of their own.
+// Chunks are advised as transparent huge pages where the host supports it, so
+// guest memory of many machines interleaved on one core stays within a few
+// dTLB entries. Set CPU8086_HUGEPAGES=0 to fall back to normal pages.
+class Arena {
+  public:
+    static const size_t CHUNK_SIZE = 2 << 20;
+
+  private:
+    std::mutex          m_lock;
+    std::vector<void *> m_chunks;
+    std::vector<size_t> m_sizes;
+    uint8_t            *m_next        = nullptr;
+    uint8_t            *m_end         = nullptr;
+    bool                m_huge_pages  = false;
+    size_t              m_huge_chunks = 0;
+
+  public:
+    Arena(bool huge_pages);
+    ~Arena();
+
+    Arena(const Arena &)            = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    static Arena &shared();
+
+    void *allocate(size_t size, size_t align);
+
+    bool   huge_pages();
+    size_t chunks();
+    size_t huge_chunks();
+
+  private:
+    void *allocateChunk(size_t size);
+};
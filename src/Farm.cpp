@@ -0,0 +1,126 @@
+#include "Farm.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+Farm::Farm(int workers) : m_workers(workers)
+{
+    if (m_workers <= 0) {
+        m_workers = std::thread::hardware_concurrency();
+    }
+    if (m_workers <= 0) {
+        m_workers = 1;
+    }
+    for (int i = 0; i < m_workers; ++i) {
+        m_queues.emplace_back(new Queue());
+    }
+}
+void Farm::set_quantum(int ms)
+{
+    m_quantum_ticks = (long long)(ms > 0 ? ms : 1) * Intel8086::PIT_HZ / 1000;
+}
+int Farm::add(Machine *machine, Until until, long long budget)
+{
+    Entry entry;
+    entry.machine = machine;
+    entry.until   = std::move(until);
+    entry.budget  = budget;
+    m_entries.push_back(std::move(entry));
+    return (int)m_entries.size() - 1;
+}
+void Farm::run()
+{
+    // Deal the machines out round robin; stealing evens out the rest.
+    int queued = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].status == STATUS_QUEUED) {
+            m_queues[queued++ % m_workers]->entries.push_back((int)i);
+        }
+    }
+    m_active = queued;
+
+    const auto               start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < m_workers; ++i) {
+        threads.emplace_back(&Farm::work, this, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    m_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+void Farm::work(int worker)
+{
+    while (m_active > 0) {
+        int index;
+        if (!take(worker, index)) {
+            // Every machine left is being run by another worker.
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+        Entry          &entry = m_entries[index];
+        const auto      start = std::chrono::steady_clock::now();
+        // A machine halted until its next timer interrupt sleeps through to
+        // it in one quantum, rather than coming back for quanta with nothing
+        // to run.
+        const long long idle    = entry.machine->idle_ticks();
+        const long long quantum = idle != LLONG_MAX ? std::max(idle, m_quantum_ticks) : m_quantum_ticks;
+        const long long ran     = entry.machine->run_ticks(quantum, entry.budget - entry.instructions);
+        entry.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        entry.instructions += ran;
+
+        if (entry.machine->stopped()) {
+            entry.status = STATUS_STOPPED;
+        } else if (entry.instructions >= entry.budget) {
+            entry.status = STATUS_BUDGET;
+        } else if (entry.until && !entry.until(*entry.machine)) {
+            entry.status = STATUS_DONE;
+        }
+        if (entry.status != STATUS_QUEUED) {
+            --m_active;
+            continue;
+        }
+        Queue                      &own = *m_queues[worker];
+        std::lock_guard<std::mutex> lock(own.lock);
+        own.entries.push_back(index);
+    }
+}
+bool Farm::take(int worker, int &index)
+{
+    {
+        Queue                      &own = *m_queues[worker];
+        std::lock_guard<std::mutex> lock(own.lock);
+        if (!own.entries.empty()) {
+            index = own.entries.front();
+            own.entries.pop_front();
+            return true;
+        }
+    }
+    for (int i = 1; i < m_workers; ++i) {
+        Queue                      &victim = *m_queues[(worker + i) % m_workers];
+        std::lock_guard<std::mutex> lock(victim.lock);
+        if (!victim.entries.empty()) {
+            index = victim.entries.back();
+            victim.entries.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+Farm::Status Farm::status(int index)
+{
+    return m_entries[index].status;
+}
+Farm::Stats Farm::stats(int index)
+{
+    const Entry &entry = m_entries[index];
+    return {entry.instructions, entry.seconds, entry.seconds > 0 ? entry.instructions / entry.seconds / 1e6 : 0};
+}
+Farm::Stats Farm::total()
+{
+    long long instructions = 0;
+    for (const Entry &entry : m_entries) {
+        instructions += entry.instructions;
+    }
+    return {instructions, m_seconds, m_seconds > 0 ? instructions / m_seconds / 1e6 : 0};
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "Machine.h"
+#include <atomic>
+#include <climits>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Runs many independent machines on a pool of worker threads, one per core
+// by default. Each worker owns a deque of machines: it takes the oldest one,
+// runs it for a quantum of emulated time and queues it again at the back.
+// A worker whose deque is empty steals the most recently queued machine of
+// another worker, and parks briefly when there is nothing to steal.
+//
+// A machine halted with interrupts enabled skips ahead to its next timer
+// interrupt in one quantum, however long, and stays off the deques until
+// then; machines halted with interrupts disabled are retired.
+class Farm {
+  public:
+    // Called on a worker after every quantum; return false to retire the
+    // machine.
+    using Until = std::function<bool(Machine &machine)>;
+
+    enum Status
+    {
+        STATUS_QUEUED,
+        STATUS_DONE,       // Until returned false
+        STATUS_STOPPED,    // halted with interrupts disabled
+        STATUS_BUDGET,     // instruction budget spent
+    };
+
+    struct Stats
+    {
+        long long instructions;
+        double    seconds;    // host time spent running
+        double    mips;
+    };
+
+  private:
+    struct Entry
+    {
+        Machine  *machine;
+        Until     until;
+        long long budget;
+        long long instructions = 0;
+        double    seconds      = 0;
+        Status    status       = STATUS_QUEUED;
+    };
+    struct Queue
+    {
+        std::mutex      lock;
+        std::deque<int> entries;
+    };
+
+    int                                 m_workers;
+    long long                           m_quantum_ticks = Intel8086::PIT_HZ / 100;    // 10 ms
+    std::vector<Entry>                  m_entries;
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::atomic<int>                    m_active{0};
+    double                              m_seconds = 0;
+
+  public:
+    // workers 0 uses one per hardware thread.
+    explicit Farm(int workers = 0);
+
+    Farm(const Farm &)            = delete;
+    Farm &operator=(const Farm &) = delete;
+
+    void set_quantum(int ms);
+
+    // Adds a machine, owned by the caller, and returns its index. It runs
+    // until until returns false, it stops, or it has run budget
+    // instructions.
+    int add(Machine *machine, Until until = nullptr, long long budget = LLONG_MAX);
+
+    // Runs all added machines to completion.
+    void run();
+
+    Status status(int index);
+    Stats  stats(int index);
+    Stats  total();
+
+  private:
+    void work(int worker);
+    bool take(int worker, int &index);
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+// Bitmap font for the 256 code page 437 characters. Each glyph is `height`
+// bytes, one per scan line, with the leftmost pixel in the top bit.
+struct Font
+{
+    int            width;
+    int            height;
+    const uint8_t *glyphs;
+};
+
+extern const Font CGA_FONT_8X8;
+extern const Font CGA_FONT_8X14;
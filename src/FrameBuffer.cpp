@@ -0,0 +1,91 @@
+#include "FrameBuffer.h"
+#include "Intel8086.h"
+#include <cstring>
+
+int VideoFrame::columns() const
+{
+    return columns(crtc);
+}
+int VideoFrame::rows() const
+{
+    return rows(crtc);
+}
+int VideoFrame::start() const
+{
+    return start(crtc);
+}
+int VideoFrame::columns(const int *crtc)
+{
+    // Unprogrammed registers read 0: fall back to 80x25.
+    return crtc[0x1] == 0 ? 80 : crtc[0x1] > MAX_COLS ? MAX_COLS : crtc[0x1];
+}
+int VideoFrame::rows(const int *crtc)
+{
+    return crtc[0x6] == 0 ? 25 : crtc[0x6] > MAX_ROWS ? MAX_ROWS : crtc[0x6];
+}
+int VideoFrame::start(const int *crtc)
+{
+    return (crtc[0xc] << 8 | crtc[0xd]) & (VRAM_SIZE / 2 - 1);
+}
+void VideoFrame::capture(Intel8086 *cpu)
+{
+    for (int i = 0; i < VRAM_PAGES; ++i) {
+        const int      page    = (VRAM_BASE >> Intel8086::PAGE_SHIFT) + i;
+        const uint32_t version = cpu->page_version(page);
+        if (version != versions[i]) {
+            memcpy(vram + i * Intel8086::PAGE_SIZE, cpu->mem_page(page << Intel8086::PAGE_SHIFT),
+                   Intel8086::PAGE_SIZE);
+            versions[i] = version;
+        }
+    }
+    for (int i = 0; i < 0x10; ++i) {
+        crtc[i] = cpu->m_crtc->getRegister(i);
+    }
+    mode  = cpu->m_crtc->getMode();
+    color = cpu->m_crtc->getColor();
+}
+const uint8_t *VideoFrame::text(uint8_t *scratch) const
+{
+    const int offset = start() * 2;
+    const int size   = columns() * rows() * 2;
+    if (offset + size <= VRAM_SIZE) {
+        return vram + offset;
+    }
+    memcpy(scratch, vram + offset, VRAM_SIZE - offset);
+    memcpy(scratch + VRAM_SIZE - offset, vram, size - (VRAM_SIZE - offset));
+    return scratch;
+}
+int VideoFrame::cursor() const
+{
+    return cursor(crtc);
+}
+int VideoFrame::cursor(const int *crtc)
+{
+    const int cell = ((crtc[0xe] << 8 | crtc[0xf]) - start(crtc)) & (VRAM_SIZE / 2 - 1);
+    return cell < columns(crtc) * rows(crtc) ? cell : -1;
+}
+int VideoFrame::cursor_shape() const
+{
+    // Blink mode 01 hides the cursor; otherwise draw it steady.
+    if ((crtc[0xa] >> 4 & 0b110) == 0b010 || cursor() < 0) {
+        return -1;
+    }
+    return crtc[0xa] << 8 | crtc[0xb];
+}
+
+VideoFrame &FrameBuffer::back()
+{
+    return m_frames[m_back];
+}
+void FrameBuffer::publish()
+{
+    m_back = m_middle.exchange(m_back | FRESH, std::memory_order_acq_rel) & ~FRESH;
+}
+const VideoFrame *FrameBuffer::consume()
+{
+    if ((m_middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+        return nullptr;
+    }
+    m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & ~FRESH;
+    return &m_frames[m_front];
+}
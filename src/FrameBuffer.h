@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+class Intel8086;
+
+// Video state captured by the CPU thread for the renderer.
+struct VideoFrame
+{
+    static const int VRAM_BASE  = 0xb8000;
+    static const int VRAM_SIZE  = 0x4000;
+    static const int VRAM_PAGES = VRAM_SIZE / 0x1000;
+    static const int MAX_COLS   = 80;
+    static const int MAX_ROWS   = 50;
+
+    uint8_t  vram[VRAM_SIZE];
+    uint32_t versions[VRAM_PAGES];    // page versions vram was copied at
+    int      crtc[0x10];
+    int      mode;                    // CGA mode control, port 0x3d8
+    int      color;                   // CGA color select, port 0x3d9
+    uint64_t sequence;
+
+    // Text geometry from the CRTC: displayed columns (R1) and rows (R6), and
+    // the start address (R12/R13) in cells. The static forms take the 16
+    // CRTC registers.
+    int columns() const;
+    int rows() const;
+    int start() const;
+
+    static int columns(const int *crtc);
+    static int rows(const int *crtc);
+    static int start(const int *crtc);
+
+    // Copies the video state of a machine into this frame. Only pages
+    // written since this frame last held them are copied.
+    void capture(Intel8086 *cpu);
+
+    // Character and attribute pairs of the displayed cells, row by row.
+    // Points into vram unless the screen wraps around the end of the
+    // buffer, in which case the cells are gathered into scratch.
+    const uint8_t *text(uint8_t *scratch) const;
+
+    // Cursor cell on screen and its start and end scan lines (R10 << 8 |
+    // R11); -1 if the cursor is off screen or hidden.
+    int        cursor() const;
+    int        cursor_shape() const;
+    static int cursor(const int *crtc);
+};
+
+// Lock-free triple buffer handing frames from one producer to one consumer.
+// The producer fills back() and publishes it; the consumer picks up the most
+// recent published frame. Neither side ever waits for the other, and a slow
+// consumer simply skips frames.
+class FrameBuffer {
+  private:
+    static const int FRESH = 0b100;
+
+    VideoFrame       m_frames[3]{};
+    std::atomic<int> m_middle{1};
+    int              m_back  = 0;
+    int              m_front = 2;
+
+  public:
+    VideoFrame       &back();
+    void              publish();
+    const VideoFrame *consume();
+};
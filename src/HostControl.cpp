@@ -0,0 +1,94 @@
+#include "HostControl.h"
+#include "Intel8086.h"
+#include <cstdio>
+
+HostControl::HostControl(Intel8086 *cpu, Exit onExit) : cpu(cpu), onExit(std::move(onExit))
+{
+    onReport = [](const Region &region) {
+        fprintf(stderr, "host: region %d: %lld instructions, %lld cycles, %.3f ms emulated, %.3f ms host, %.2f MIPS\n",
+                region.id, region.instructions, region.cycles, region.emulated_seconds * 1000,
+                region.host_seconds * 1000,
+                region.host_seconds > 0 ? region.instructions / region.host_seconds / 1e6 : 0.0);
+    };
+}
+HostControl::~HostControl()
+{
+    fflush(stdout);
+}
+void HostControl::setReport(Report onReport)
+{
+    this->onReport = std::move(onReport);
+}
+bool HostControl::isConnected(int port)
+{
+    return port >= PORT_FIRST && port <= PORT_LAST;
+}
+int HostControl::portIn(int w, int port)
+{
+    switch (port) {
+        case 0xe0:
+            return SIGNATURE;
+        case 0xe4: {
+            const int val = (int)(latch & (w ? 0xffff : 0xff));
+            latch >>= w ? 16 : 8;
+            return val;
+        }
+        default:
+            return 0;
+    }
+}
+void HostControl::portOut(int w, int port, int val)
+{
+    switch (port) {
+        case 0xe0:
+            command(val & 0xff);
+            break;
+        case 0xe1:
+            putchar(val & 0xff);
+            break;
+        case 0xe2:
+            argument = w ? val & 0xffff : (argument & 0xff00) | (val & 0xff);
+            break;
+        case 0xe3:
+            argument = (argument & 0xff) | (val & 0xff) << 8;
+            break;
+    }
+}
+void HostControl::command(int cmd)
+{
+    const Clock::time_point now   = Clock::now();
+    Start                  &start = starts[argument & 0xff];
+    switch (cmd) {
+        case CMD_START:
+            start = {true, cpu->get_cycles(), cpu->get_ticks(), now};
+            break;
+        case CMD_STOP: {
+            if (!start.open) {
+                latch = 0;
+                break;
+            }
+            Region region;
+            region.id               = argument & 0xff;
+            region.instructions     = cpu->get_cycles() - start.instructions;
+            region.cycles           = (cpu->get_ticks() - start.ticks) * CLOCKS_PER_TICK;
+            region.emulated_seconds = (double)(cpu->get_ticks() - start.ticks) / Intel8086::PIT_HZ;
+            region.host_seconds     = std::chrono::duration<double>(now - start.host).count();
+            start.open              = false;
+            latch                   = region.instructions;
+            // Keep the guest's output ahead of the report.
+            fflush(stdout);
+            onReport(region);
+            break;
+        }
+        case CMD_CLOCK:
+            latch = std::chrono::duration_cast<std::chrono::nanoseconds>(now - epoch).count();
+            break;
+        case CMD_EXIT:
+            fflush(stdout);
+            if (onExit) {
+                // Exit statuses are 8 bits wide.
+                onExit(argument & 0xff);
+            }
+            break;
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Peripheral.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+class Intel8086;
+
+// Paravirtual device for instrumented guest programs; no real PC has it, so
+// frontends only map it when asked to. Ports:
+//
+//   0xe0  write: command; read: 0x48 ('H') when the device is there
+//   0xe1  write: a byte for the host's stdout
+//   0xe2  write: argument of the next command, a byte or word (0xe3 high)
+//   0xe4  read: next byte or word of the result, lowest first
+//
+// Commands:
+//
+//   CMD_START  start counting region <argument>
+//   CMD_STOP   stop region <argument>, report it and latch its instructions
+//   CMD_CLOCK  latch the host clock, in nanoseconds since the device started
+//   CMD_EXIT   ask the host to exit with status <argument> & 0xff
+//
+// From BASIC, OUT &HE2,1: OUT &HE0,1 starts region 1.
+class HostControl : public Peripheral {
+  public:
+    static const int PORT_FIRST = 0xe0;
+    static const int PORT_LAST  = 0xe7;
+
+    static const int CMD_START = 1;
+    static const int CMD_STOP  = 2;
+    static const int CMD_CLOCK = 3;
+    static const int CMD_EXIT  = 4;
+
+    static const int SIGNATURE = 0x48;
+
+    struct Region
+    {
+        int       id;
+        long long instructions;
+        long long cycles;              // 4.77 MHz CPU clocks
+        double    emulated_seconds;
+        double    host_seconds;
+    };
+
+    using Report = std::function<void(const Region &region)>;
+    using Exit   = std::function<void(int status)>;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    // The 4.77 MHz CPU clock runs at 4 times the PIT clock.
+    static const int CLOCKS_PER_TICK = 4;
+
+    struct Start
+    {
+        bool              open;
+        long long         instructions;
+        long long         ticks;
+        Clock::time_point host;
+    };
+
+    Intel8086        *cpu;
+    Exit              onExit;
+    Report            onReport;
+    Clock::time_point epoch    = Clock::now();
+    Start             starts[256]{};
+    int               argument = 0;
+    uint64_t          latch    = 0;
+
+  public:
+    // onExit is called on the thread running the machine.
+    HostControl(Intel8086 *cpu, Exit onExit);
+    ~HostControl();
+
+    // Replaces the default report, a line on stderr.
+    void setReport(Report onReport);
+
+    bool isConnected(int port) override;
+    int  portIn(int w, int port) override;
+    void portOut(int w, int port, int val) override;
+
+  private:
+    void command(int cmd);
+};
@@ -1,11 +1,12 @@
 #include "Intel8086.h"
+#include <algorithm>
 #include <chrono>
-#include <corecrt.h>
-#include <crtdbg.h>
 #include <cstddef>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <thread>
 
 using namespace std;
@@ -26,11 +27,11 @@ const int CX = 0b001;
 const int DX = 0b010;
 const int BX = 0b011;
 
-std::vector<int> BITS = std::vector<int>{8, 16};
-std::vector<int> SIGN = std::vector<int>{0x80, 0x8000};
+// Lookup tables are plain arrays so the hot path does not chase heap pointers.
+const int SIGN[] = {0x80, 0x8000};
 
-const std::vector<int> MASK   = {0xff, 0xffff};
-const std::vector<int> PARITY = {
+const int     MASK[]      = {0xff, 0xffff};
+const uint8_t PARITY[256] = {
     1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1,
     0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0,
     0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0,
@@ -45,22 +46,41 @@ Intel8086::Intel8086()
     m_pic         = new Intel8259();
     m_pit         = new Intel8253(m_pic);
     m_ppi         = new Intel8255(m_pic);
-    m_crtc        = new Motorola6845();
+    m_crtc        = new Motorola6845(&ticks);
     m_peripherals = std::vector<Peripheral *>{m_dma, m_pic, m_pit, m_ppi, m_crtc};
+
+    for (int port = 0; port < 0x10000; ++port) {
+        for (size_t i = 0; i < m_peripherals.size(); ++i) {
+            if (m_peripherals[i]->isConnected(port)) {
+                m_port_map[port] = i + 1;
+                break;
+            }
+        }
+    }
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        mapRam(page, nullptr);
+    }
 }
 Intel8086::~Intel8086()
 {
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        if (m_ram[page] != nullptr) {
+            PagePool::shared().release(m_ram[page]);
+        }
+    }
     delete m_dma;
     delete m_pic;
     delete m_pit;
     delete m_ppi;
     delete m_crtc;
 }
-void Intel8086::init()
+void Intel8086::init(const std::string &bios, const std::string &basic)
 {
     reset();
-    load(0xfe000, "bin\\bios.bin");
-    load(0xf6000, "bin\\basic.bin");
+    load(0xfe000, bios);
+    if (!basic.empty()) {
+        load(0xf6000, basic);
+    }
 }
 void Intel8086::reset()
 {
@@ -73,21 +93,338 @@ void Intel8086::reset()
     for (int i = 0; i < 6; i++) {
         queue[i] = 0;
     }
-    clocks = 0;
+    clocks   = 0;
+    m_halted = false;
 }
 void Intel8086::load(int addr, std::string path)
 {
-    FILE *f = fopen(path.c_str(), "rb");
-    fseek(f, 0, SEEK_END);
-    const int size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    auto buffer = new uint8_t[size];
-    fread(buffer, size, 1, f);
-    for (int i = 0; i < size; i++) {
-        m_memory[addr + i] = buffer[i] & 0xff;
+    auto rom = RomImage::open(path);
+    if (addr < 0 || addr + rom->size() > 0x100000) {
+        throw std::runtime_error(path + ": ROM image does not fit in the address space");
+    }
+    // Protection is per page: a partial page would turn the RAM around the
+    // image read-only.
+    if ((addr & (PAGE_SIZE - 1)) != 0 || (rom->size() & (PAGE_SIZE - 1)) != 0) {
+        throw std::runtime_error(path + ": ROM image does not start and end on a 4 KB boundary");
+    }
+    // Map the shared image straight into the guest address space.
+    const int first = addr >> PAGE_SHIFT;
+    const int last  = (int)(addr + rom->size() - 1) >> PAGE_SHIFT;
+    for (int page = first; page <= last; ++page) {
+        if (m_ram[page] != nullptr) {
+            PagePool::shared().release(m_ram[page]);
+            m_ram[page] = nullptr;
+        }
+        m_page_data[page] = rom->data() + ((page - first) << PAGE_SHIFT);
+        m_read_map[page]  = (m_page_flags[page] & PAGE_HOOK) != 0 ? nullptr : m_page_data[page];
+        m_write_map[page] = nullptr;
+        m_page_flags[page] |= PAGE_ROM;
+    }
+    m_roms.push_back(rom);
+}
+int Intel8086::read_byte(int addr)
+{
+    return read8(addr);
+}
+void Intel8086::write_byte(int addr, int val)
+{
+    write8(addr, val);
+}
+const uint8_t *Intel8086::mem_page(int addr)
+{
+    return m_page_data[(addr & 0xfffff) >> PAGE_SHIFT];
+}
+int Intel8086::resident_pages()
+{
+    int count = 0;
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        if (m_ram[page] != nullptr) {
+            ++count;
+        }
+    }
+    return count;
+}
+int Intel8086::release_zero_pages()
+{
+    // BIOS POST clears all of RAM; hand pages that still hold only zeros
+    // back to the pool so idle machines shrink to their working set.
+    int count = 0;
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        uint8_t *data = m_ram[page];
+        if (data == nullptr || (m_page_flags[page] & PAGE_ROM) != 0) {
+            continue;
+        }
+        if (data[0] == 0 && memcmp(data, data + 1, PAGE_SIZE - 1) == 0) {
+            mapRam(page, nullptr);
+            PagePool::shared().release(data);
+            ++count;
+        }
+    }
+    return count;
+}
+uint32_t Intel8086::page_version(int page)
+{
+    // Write protect the page so the next store to it bumps the version.
+    m_write_map[page] = nullptr;
+    return m_page_version[page];
+}
+void Intel8086::load_page(int page, const uint8_t *data)
+{
+    if ((m_page_flags[page] & PAGE_ROM) != 0) {
+        return;
+    }
+    if (m_ram[page] == nullptr) {
+        if ((m_page_flags[page] & PAGE_SHARED) == 0 && data[0] == 0 && memcmp(data, data + 1, PAGE_SIZE - 1) == 0) {
+            return;
+        }
+        mapRam(page, PagePool::shared().allocate());
+    }
+    memcpy(m_ram[page], data, PAGE_SIZE);
+    m_write_map[page] = (m_page_flags[page] & (PAGE_WATCH | PAGE_HOOK)) != 0 ? nullptr : m_ram[page];
+    ++m_page_version[page];
+    if ((m_page_flags[page] & PAGE_WATCH) != 0) {
+        ++m_watch_hits;
+    }
+}
+bool Intel8086::is_rom_page(int page)
+{
+    return (m_page_flags[page] & PAGE_ROM) != 0;
+}
+void Intel8086::watch_writes(int begin, int end)
+{
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        m_page_flags[page] &= ~PAGE_WATCH;
+    }
+    m_watch_begin = begin;
+    m_watch_end   = end;
+    if (begin >= end) {
+        return;
+    }
+    for (int page = begin >> PAGE_SHIFT; page <= (end - 1) >> PAGE_SHIFT; ++page) {
+        m_page_flags[page] |= PAGE_WATCH;
+        m_write_map[page] = nullptr;
+    }
+}
+uint64_t Intel8086::watch_hits()
+{
+    return m_watch_hits;
+}
+int Intel8086::get_register(Register reg)
+{
+    switch (reg) {
+        case REG_AX:
+            return ah << 8 | al;
+        case REG_BX:
+            return bh << 8 | bl;
+        case REG_CX:
+            return ch << 8 | cl;
+        case REG_DX:
+            return dh << 8 | dl;
+        case REG_SP:
+            return sp;
+        case REG_BP:
+            return bp;
+        case REG_SI:
+            return si;
+        case REG_DI:
+            return di;
+        case REG_CS:
+            return cs;
+        case REG_DS:
+            return ds;
+        case REG_SS:
+            return ss;
+        case REG_ES:
+            return es;
+        case REG_IP:
+            return ip;
+        case REG_FLAGS:
+            return flags;
+    }
+    return 0;
+}
+void Intel8086::set_register(Register reg, int val)
+{
+    val &= 0xffff;
+    switch (reg) {
+        case REG_AX:
+            ah = val >> 8;
+            al = val & 0xff;
+            break;
+        case REG_BX:
+            bh = val >> 8;
+            bl = val & 0xff;
+            break;
+        case REG_CX:
+            ch = val >> 8;
+            cl = val & 0xff;
+            break;
+        case REG_DX:
+            dh = val >> 8;
+            dl = val & 0xff;
+            break;
+        case REG_SP:
+            sp = val;
+            break;
+        case REG_BP:
+            bp = val;
+            break;
+        case REG_SI:
+            si = val;
+            break;
+        case REG_DI:
+            di = val;
+            break;
+        case REG_CS:
+            cs = val;
+            break;
+        case REG_DS:
+            ds = val;
+            break;
+        case REG_SS:
+            ss = val;
+            break;
+        case REG_ES:
+            es = val;
+            break;
+        case REG_IP:
+            ip = val;
+            break;
+        case REG_FLAGS:
+            flags = val;
+            break;
+    }
+}
+void Intel8086::map_ports(Peripheral *peripheral, int first, int last)
+{
+    size_t index = 0;
+    while (index < m_peripherals.size() && m_peripherals[index] != peripheral) {
+        ++index;
     }
-    fclose(f);
-    delete[] buffer;
+    if (index == m_peripherals.size()) {
+        if (index == 0xff) {
+            throw std::runtime_error("too many peripherals");
+        }
+        m_peripherals.push_back(peripheral);
+    }
+    for (int port = first; port <= last && port < 0x10000; ++port) {
+        m_port_map[port] = index + 1;
+    }
+}
+void Intel8086::hook_memory(int first, int last, MemoryRead read, MemoryWrite write)
+{
+    if (m_hooks.size() == 0xff) {
+        throw std::runtime_error("too many memory hooks");
+    }
+    first &= 0xfffff;
+    last &= 0xfffff;
+    m_hooks.push_back({first, last, std::move(read), std::move(write)});
+    for (int page = first >> PAGE_SHIFT; page <= last >> PAGE_SHIFT; ++page) {
+        m_page_hook[page] = m_hooks.size();
+        m_page_flags[page] |= PAGE_HOOK;
+        m_read_map[page]  = nullptr;
+        m_write_map[page] = nullptr;
+    }
+}
+void Intel8086::save_state(State &st)
+{
+    st.ah     = ah;
+    st.al     = al;
+    st.bh     = bh;
+    st.bl     = bl;
+    st.ch     = ch;
+    st.cl     = cl;
+    st.dh     = dh;
+    st.dl     = dl;
+    st.sp     = sp;
+    st.bp     = bp;
+    st.si     = si;
+    st.di     = di;
+    st.cs     = cs;
+    st.ds     = ds;
+    st.ss     = ss;
+    st.es     = es;
+    st.ip     = ip;
+    st.flags  = flags;
+    st.clocks = clocks;
+    st.cycles = cycles;
+    st.ticks  = ticks;
+
+    st.poll_cycle  = m_poll_cycle;
+    st.poll_status = m_poll_status;
+    st.halted      = m_halted;
+    m_dma->saveState(st.dma);
+    m_pic->saveState(st.pic);
+    m_pit->saveState(st.pit);
+    m_ppi->saveState(st.ppi);
+    m_crtc->saveState(st.crtc);
+}
+void Intel8086::load_state(const State &st)
+{
+    ah     = st.ah;
+    al     = st.al;
+    bh     = st.bh;
+    bl     = st.bl;
+    ch     = st.ch;
+    cl     = st.cl;
+    dh     = st.dh;
+    dl     = st.dl;
+    sp     = st.sp;
+    bp     = st.bp;
+    si     = st.si;
+    di     = st.di;
+    cs     = st.cs;
+    ds     = st.ds;
+    ss     = st.ss;
+    es     = st.es;
+    ip     = st.ip;
+    flags  = st.flags;
+    clocks = st.clocks;
+    cycles = st.cycles;
+    ticks  = st.ticks;
+
+    m_poll_cycle  = st.poll_cycle;
+    m_poll_status = st.poll_status;
+    m_halted      = st.halted != 0;
+    m_dma->loadState(st.dma);
+    m_pic->loadState(st.pic);
+    m_pit->loadState(st.pit);
+    m_ppi->loadState(st.ppi);
+    m_crtc->loadState(st.crtc);
+}
+void Intel8086::fork(Intel8086 &base)
+{
+    State st;
+    base.save_state(st);
+    load_state(st);
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        if ((m_page_flags[page] & PAGE_ROM) != 0) {
+            continue;
+        }
+        if (m_ram[page] != nullptr) {
+            PagePool::shared().release(m_ram[page]);
+        }
+        mapRam(page, nullptr);
+        if (base.m_ram[page] != nullptr) {
+            m_page_data[page] = base.m_ram[page];
+            m_read_map[page]  = (m_page_flags[page] & PAGE_HOOK) != 0 ? nullptr : m_page_data[page];
+            m_page_flags[page] |= PAGE_SHARED;
+        }
+        // Pages change under anyone who read their version before.
+        ++m_page_version[page];
+    }
+}
+long long Intel8086::get_cycles()
+{
+    return cycles;
+}
+long long Intel8086::get_ticks()
+{
+    return ticks;
+}
+void Intel8086::set_idle_skip(bool enable)
+{
+    m_idle_skip = enable;
 }
 void Intel8086::run()
 {
@@ -102,8 +439,47 @@ void Intel8086::run_step(size_t steps, bool show_op)
             break;
     }
 }
+void Intel8086::run_until(long long tick_limit, long long cycle_limit)
+{
+    while (ticks < tick_limit && cycles < cycle_limit) {
+        const long long idle = ticks_to_wake();
+        if (idle > 0) {
+            if (idle == LLONG_MAX && tick_limit == LLONG_MAX) {
+                break;
+            }
+            const long long skip = std::min(idle, tick_limit - ticks);
+            ticks += skip;
+            m_pit->skip(skip);
+            continue;
+        }
+        tick(false);
+        if (m_halted && !getFlag(IF)) {
+            break;
+        }
+    }
+}
+bool Intel8086::halted()
+{
+    return m_halted;
+}
+long long Intel8086::ticks_to_wake()
+{
+    if (!m_halted || !getFlag(IF) || m_pic->hasInt()) {
+        return 0;
+    }
+    return m_pit->ticksToIrq();
+}
 bool Intel8086::tick(bool show_op)
 {
+    if (m_halted) {
+        if (!getFlag(IF) || !m_pic->hasInt()) {
+            // Only time passes until an interrupt comes in.
+            ++ticks;
+            m_pit->tick();
+            return false;
+        }
+        m_halted = false;
+    }
     if (getFlag(TF)) {
         callInt(1);
         clocks += 50;
@@ -195,6 +571,7 @@ bool Intel8086::cycle_opcode(int rep, bool show_op)
 
         while (clocks > 3) {
             clocks -= 4;
+            ++ticks;
             m_pit->tick();
         }
 
@@ -208,7 +585,7 @@ bool Intel8086::cycle_opcode(int rep, bool show_op)
     } while (rep > 0);
     return true;
 }
-bool Intel8086::exe_opcode(int rep, bool show_op)
+bool Intel8086::exe_opcode(int &rep, bool show_op)
 {
     int dst, src, res;
     switch (op) {
@@ -1210,6 +1587,7 @@ bool Intel8086::exe_opcode(int rep, bool show_op)
             break;
         case 0xf4:    // HLT
             clocks += 2;
+            m_halted = true;
             return false;
         case 0x9b:    // WAIT
             clocks += 3;
@@ -1702,7 +2080,7 @@ int Intel8086::shift(int x, int n)
 }
 int Intel8086::signconv(int w, int x)
 {
-    return x << (32 - BITS[w]) >> (32 - BITS[w]);
+    return x << (32 - (8 << w)) >> (32 - (8 << w));
 }
 int Intel8086::adc(int w, int dst, int src)
 {
@@ -1710,7 +2088,7 @@ int Intel8086::adc(int w, int dst, int src)
     int res   = dst + src + carry & MASK[w];
     setFlag(CF, carry == 1 ? res <= dst : res < dst);
     setFlag(AF, ((res ^ dst ^ src) & AF) > 0);
-    setFlag(OF, (shift((dst ^ src ^ -1) & (dst ^ res), 12 - BITS[w]) & OF) > 0);
+    setFlag(OF, (shift((dst ^ src ^ -1) & (dst ^ res), 12 - (8 << w)) & OF) > 0);
     setFlags(w, res);
     return res;
 }
@@ -1719,7 +2097,7 @@ int Intel8086::add(int w, int dst, int src)
     int res = dst + src & MASK[w];
     setFlag(CF, res < dst);
     setFlag(AF, ((res ^ dst ^ src) & AF) > 0);
-    setFlag(OF, (shift((dst ^ src ^ -1) & (dst ^ res), 12 - BITS[w]) & OF) > 0);
+    setFlag(OF, (shift((dst ^ src ^ -1) & (dst ^ res), 12 - (8 << w)) & OF) > 0);
     setFlags(w, res);
     return res;
 }
@@ -1729,7 +2107,7 @@ int Intel8086::sbb(int w, int dst, int src)
     int res   = dst - src - carry & MASK[w];
     setFlag(CF, carry > 0 ? dst <= src : dst < src);
     setFlag(AF, ((res ^ dst ^ src) & AF) > 0);
-    setFlag(OF, (shift((dst ^ src) & (dst ^ res), 12 - BITS[w]) & OF) > 0);
+    setFlag(OF, (shift((dst ^ src) & (dst ^ res), 12 - (8 << w)) & OF) > 0);
     setFlags(w, res);
     return res;
 }
@@ -1738,7 +2116,7 @@ int Intel8086::sub(int w, int dst, int src)
     int res = dst - src & MASK[w];
     setFlag(CF, dst < src);
     setFlag(AF, ((res ^ dst ^ src) & AF) > 0);
-    setFlag(OF, (shift((dst ^ src) & (dst ^ res), 12 - BITS[w]) & OF) > 0);
+    setFlag(OF, (shift((dst ^ src) & (dst ^ res), 12 - (8 << w)) & OF) > 0);
     setFlags(w, res);
     return res;
 }
@@ -1833,24 +2211,99 @@ int Intel8086::getEA(int mod, int rm)
     }
     return (os << 4) + (ea & 0xffff);
 }
+int Intel8086::read8(int addr)
+{
+    addr &= 0xfffff;
+    const uint8_t *page = m_read_map[addr >> PAGE_SHIFT];
+    if (page != nullptr) {
+        return page[addr & (PAGE_SIZE - 1)];
+    }
+    return readSlow(addr);
+}
+void Intel8086::write8(int addr, int val)
+{
+    addr &= 0xfffff;
+    uint8_t *page = m_write_map[addr >> PAGE_SHIFT];
+    if (page != nullptr) {
+        page[addr & (PAGE_SIZE - 1)] = val & 0xff;
+    } else {
+        writeSlow(addr, val);
+    }
+}
+int Intel8086::readSlow(int addr)
+{
+    const int         page = addr >> PAGE_SHIFT;
+    const MemoryHook &hook = m_hooks[m_page_hook[page] - 1];
+    if (addr >= hook.first && addr <= hook.last && hook.read) {
+        return hook.read(addr) & 0xff;
+    }
+    return m_page_data[page][addr & (PAGE_SIZE - 1)];
+}
+void Intel8086::writeSlow(int addr, int val)
+{
+    const int page = addr >> PAGE_SHIFT;
+    if ((m_page_flags[page] & PAGE_HOOK) != 0) {
+        const MemoryHook &hook = m_hooks[m_page_hook[page] - 1];
+        if (addr >= hook.first && addr <= hook.last && hook.write) {
+            hook.write(addr, val & 0xff);
+            return;
+        }
+    }
+    if ((m_page_flags[page] & PAGE_ROM) != 0) {
+        // IBM BIOS and BASIC are ROM.
+        return;
+    }
+    if (m_ram[page] == nullptr) {
+        if ((m_page_flags[page] & PAGE_SHARED) != 0) {
+            // First store to a page still shared with the base machine.
+            uint8_t *data = PagePool::shared().allocate();
+            memcpy(data, m_page_data[page], PAGE_SIZE);
+            mapRam(page, data);
+        } else if ((val & 0xff) == 0) {
+            // Untouched pages already read as zero.
+            return;
+        } else {
+            mapRam(page, PagePool::shared().allocate());
+        }
+    }
+    // First store since the page was allocated or its version was read.
+    ++m_page_version[page];
+    m_ram[page][addr & (PAGE_SIZE - 1)] = val & 0xff;
+    if ((m_page_flags[page] & PAGE_WATCH) != 0 && addr >= m_watch_begin && addr < m_watch_end) {
+        ++m_watch_hits;
+    }
+    if ((m_page_flags[page] & (PAGE_WATCH | PAGE_HOOK)) != 0) {
+        // Watched and hooked pages stay write protected so every store is seen.
+        return;
+    }
+    m_write_map[page] = m_ram[page];
+}
+void Intel8086::mapRam(int page, uint8_t *data)
+{
+    m_page_flags[page] &= ~PAGE_SHARED;
+    m_ram[page]       = data;
+    m_page_data[page] = data != nullptr ? data : PagePool::zero_page();
+    m_read_map[page]  = (m_page_flags[page] & PAGE_HOOK) != 0 ? nullptr : m_page_data[page];
+    m_write_map[page] = (m_page_flags[page] & (PAGE_WATCH | PAGE_HOOK)) != 0 ? nullptr : data;
+}
 int Intel8086::getMem(int w)
 {
     int addr = getAddr(cs, ip);
-    int val  = m_memory[addr];
+    int val  = read8(addr);
     if (w == W) {
-        val |= m_memory[addr + 1] << 8;
+        val |= read8(addr + 1) << 8;
     }
     ip = ip + 1 + w & 0xffff;
     return val;
 }
 int Intel8086::getMem(int w, int addr)
 {
-    int val = m_memory[addr];
+    int val = read8(addr);
     if (w == W) {
         if ((addr & 0b1) == 0b1) {
             clocks += 4;
         }
-        val |= m_memory[addr + 1] << 8;
+        val |= read8(addr + 1) << 8;
     }
     return val;
 }
@@ -1925,16 +2378,12 @@ bool Intel8086::getFlag(int flag)
 }
 void Intel8086::setMem(int w, int addr, int val)
 {
-    // IBM BIOS and BASIC are ROM.
-    if (addr >= 0xf6000) {
-        return;
-    }
-    m_memory[addr] = val & 0xff;
+    write8(addr, val);
     if (w == W) {
         if ((addr & 0b1) == 0b1) {
             clocks += 4;
         }
-        m_memory[addr + 1] = val >> 8 & 0xff;
+        write8(addr + 1, val >> 8);
     }
 }
 void Intel8086::setReg(int w, int reg, int val)
@@ -2036,7 +2485,7 @@ void Intel8086::setFlags(int w, int res)
 {
     setFlag(PF, PARITY[res & 0xff] > 0);
     setFlag(ZF, res == 0);
-    setFlag(SF, (shift(res, 8 - BITS[w]) & SF) > 0);
+    setFlag(SF, (shift(res, 8 - (8 << w)) & SF) > 0);
 }
 int Intel8086::inc(int w, int dst)
 {
@@ -2065,20 +2514,43 @@ void Intel8086::push(int val)
 }
 int Intel8086::portIn(int w, int port)
 {
-    for (auto peripheral : m_peripherals) {
-        if (peripheral->isConnected(port)) {
-            return peripheral->portIn(w, port);
+    const int index = m_port_map[port & 0xffff];
+    if (index == 0) {
+        return 0;
+    }
+    Peripheral *peripheral = m_peripherals[index - 1];
+    if (port == 0x3da && peripheral == m_crtc) {
+        return pollStatus();
+    }
+    return peripheral->portIn(w, port);
+}
+int Intel8086::pollStatus()
+{
+    // A loop waiting for retrace reads the same status until the next edge.
+    // On the second identical poll in quick succession the wait is charged
+    // to this instruction, and the loop sees the edge on its next poll.
+    // Such loops test the status right after the IN with TEST AL,imm8 or
+    // AND AL,imm8; then only the tested bits need to change.
+    const int status = m_crtc->getStatus();
+    if (m_idle_skip && cycles - m_poll_cycle <= IDLE_POLL_GAP) {
+        const int next = read8(getAddr(cs, ip));
+        const int mask = next == 0xa8 || next == 0x24 ? read8(getAddr(cs, ip + 1)) : 0xff;
+        if (((status ^ m_poll_status) & mask) == 0) {
+            const long long edge = m_crtc->nextEdge(mask);
+            if (edge > ticks) {
+                clocks += (edge - ticks) * 4;
+            }
         }
     }
-    return 0;
+    m_poll_status = status;
+    m_poll_cycle  = cycles;
+    return status;
 }
 void Intel8086::portOut(int w, int port, int val)
 {
-    for (auto peripheral : m_peripherals) {
-        if (peripheral->isConnected(port)) {
-            peripheral->portOut(w, port, val);
-            return;
-        }
+    const int index = m_port_map[port & 0xffff];
+    if (index != 0) {
+        m_peripherals[index - 1]->portOut(w, port, val);
     }
 }
 void Intel8086::show_info(int op)
@@ -1,3 +1,7 @@
+#pragma once
+#include <climits>
+#include <functional>
+#include <memory>
 #include <string>
 //#include <vector>
 #include "Intel8237.h"
@@ -5,6 +9,8 @@
 #include "Intel8253.h"
 #include "Intel8255.h"
 #include "Motorola6845.h"
+#include "PagePool.h"
+#include "RomImage.h"
 
 class Intel8237;
 class Intel8259;
@@ -14,7 +20,51 @@ class Motorola6845;
 
 class Intel8086 {
   public:
-    uint8_t                   m_memory[0x100000]{};
+    static const int PAGE_SHIFT = 12;
+    static const int PAGE_SIZE  = 1 << PAGE_SHIFT;
+    static const int PAGE_COUNT = 0x100000 >> PAGE_SHIFT;
+    static const int PIT_HZ     = 1193182;
+
+    enum Register
+    {
+        REG_AX,
+        REG_BX,
+        REG_CX,
+        REG_DX,
+        REG_SP,
+        REG_BP,
+        REG_SI,
+        REG_DI,
+        REG_CS,
+        REG_DS,
+        REG_SS,
+        REG_ES,
+        REG_IP,
+        REG_FLAGS,
+    };
+
+    // Memory hook callbacks, called with the physical address of each byte.
+    using MemoryRead  = std::function<int(int addr)>;
+    using MemoryWrite = std::function<void(int addr, int val)>;
+
+    // Everything but memory, for snapshots.
+    struct State
+    {
+        int                 ah, al, bh, bl, ch, cl, dh, dl;
+        int                 sp, bp, si, di;
+        int                 cs, ds, ss, es;
+        int                 ip, flags;
+        long long           clocks, cycles, ticks;
+        long long           poll_cycle;
+        int                 poll_status;
+        int                 halted;
+        Intel8237::State    dma;
+        Intel8259::State    pic;
+        Intel8253::State    pit;
+        Intel8255::State    ppi;
+        Motorola6845::State crtc;
+    };
+
     Intel8237                *m_dma  = nullptr;
     Intel8259                *m_pic  = nullptr;
     Intel8253                *m_pit  = nullptr;
@@ -23,6 +73,48 @@ class Intel8086 {
     std::vector<Peripheral *> m_peripherals;
 
   private:
+    static const int PAGE_ROM    = 0b0001;
+    static const int PAGE_WATCH  = 0b0010;
+    static const int PAGE_HOOK   = 0b0100;
+    static const int PAGE_SHARED = 0b1000;
+
+    struct MemoryHook
+    {
+        int         first;
+        int         last;
+        MemoryRead  read;
+        MemoryWrite write;
+    };
+
+    // Instructions between two status polls that still count as a wait loop.
+    static const int IDLE_POLL_GAP = 16;
+
+    // Memory map: one host pointer per guest page. A null write entry sends
+    // stores to writeSlow(), which handles ROM, untouched RAM pages, hooked
+    // pages, pages shared with the machine this one was forked from and
+    // write protected pages whose version was read by page_version().
+    // Untouched RAM reads as the shared zero page until its first write.
+    // Only hooked pages have a null read entry; m_page_data holds what they
+    // read as outside the hooked range.
+    const uint8_t                         *m_read_map[PAGE_COUNT]{};
+    uint8_t                               *m_write_map[PAGE_COUNT]{};
+    const uint8_t                         *m_page_data[PAGE_COUNT]{};
+    uint8_t                               *m_ram[PAGE_COUNT]{};
+    uint32_t                               m_page_version[PAGE_COUNT]{};
+    uint8_t                                m_page_flags[PAGE_COUNT]{};
+    std::vector<std::shared_ptr<RomImage>> m_roms;
+
+    // Write watch: pages overlapping the range stay write protected, and
+    // stores inside it are counted.
+    int      m_watch_begin = 0;
+    int      m_watch_end   = 0;
+    uint64_t m_watch_hits  = 0;
+
+    // Memory hooks by page and peripherals by port, as 1 + index; 0 is none.
+    std::vector<MemoryHook> m_hooks;
+    uint8_t                 m_page_hook[PAGE_COUNT]{};
+    uint8_t                 m_port_map[0x10000]{};
+
     int ah = 0, al = 0;
     int bh = 0, bl = 0;
     int ch = 0, cl = 0;
@@ -40,7 +132,7 @@ class Intel8086 {
     int ip    = 0;
     int flags = 0;
 
-    std::vector<int> queue = std::vector<int>(6);
+    int queue[6]{};
 
     int       op     = 0;
     int       d      = 0;
@@ -52,22 +144,83 @@ class Intel8086 {
     long long clocks = 0;
 
     long long cycles = 0;
+    long long ticks  = 0;
+
+    // Last CRTC status poll, for skipping retrace wait loops.
+    bool      m_idle_skip   = true;
+    long long m_poll_cycle  = -IDLE_POLL_GAP - 1;
+    int       m_poll_status = -1;
+
+    // Set by HLT; cleared when an interrupt is taken.
+    bool m_halted = false;
 
   public:
     Intel8086();
     ~Intel8086();
 
-    void init();
+    // Loads the BIOS and, unless the path is empty, cassette BASIC.
+    void init(const std::string &bios = "bin/bios.bin", const std::string &basic = "bin/basic.bin");
     void reset();
+
+    // Maps a ROM image read-only at addr; it must start and end on a page
+    // boundary.
     void load(int addr, std::string path);
 
     void run();
     void run_step(size_t steps, bool show_op);
 
+    // Runs until the PIT clock reaches tick_limit or the instruction count
+    // reaches cycle_limit, whichever comes first. A halted CPU skips ahead
+    // to the next timer interrupt in one step; it returns at once if it
+    // halted with interrupts disabled, or if no timer will wake it and there
+    // is no tick_limit, since nothing can wake it.
+    void run_until(long long tick_limit, long long cycle_limit = LLONG_MAX);
+    bool halted();
+
+    // PIT ticks before the timer can wake a CPU halted with interrupts
+    // enabled, at least; 0 if it is not waiting and LLONG_MAX if no timer
+    // will wake it.
+    long long ticks_to_wake();
+
+    int            read_byte(int addr);
+    void           write_byte(int addr, int val);
+    const uint8_t *mem_page(int addr);
+    int            resident_pages();
+    int            release_zero_pages();
+    uint32_t       page_version(int page);
+    void           load_page(int page, const uint8_t *data);
+    bool           is_rom_page(int page);
+    void           watch_writes(int begin, int end);
+    uint64_t       watch_hits();
+
+    int  get_register(Register reg);
+    void set_register(Register reg, int val);
+
+    // Routes ports first to last to a peripheral, over any earlier mapping.
+    // The caller keeps ownership of peripherals it adds this way.
+    void map_ports(Peripheral *peripheral, int first, int last);
+
+    // Sends accesses to physical addresses first to last to callbacks; a null
+    // callback leaves that direction to memory. A page holds one hook, the
+    // latest that covers it.
+    void hook_memory(int first, int last, MemoryRead read, MemoryWrite write);
+
+    void      save_state(State &st);
+    void      load_state(const State &st);
+
+    // Takes over the state and RAM of base, which must have been set up with
+    // the same ROMs. RAM pages are shared until this machine first writes to
+    // them, so base must outlive its forks and must not run or change its
+    // memory while any of them is alive.
+    void      fork(Intel8086 &base);
+    long long get_cycles();
+    long long get_ticks();
+    void      set_idle_skip(bool enable);
+
   private:
     bool tick(bool show_op);
     bool cycle_opcode(int rep, bool show_op);
-    bool exe_opcode(int rep, bool show_op);
+    bool exe_opcode(int &rep, bool show_op);
 
     bool msb(int w, int x);
     int  shift(int x, int n);
@@ -86,6 +239,12 @@ class Intel8086 {
     int getEA(int mod, int rm);
 
     bool getFlag(int flag);
+    int  read8(int addr);
+    void write8(int addr, int val);
+    int  readSlow(int addr);
+    void writeSlow(int addr, int val);
+    void mapRam(int page, uint8_t *data);
+
     int  getMem(int w);
     int  getMem(int w, int addr);
     int  getReg(int w, int reg);
@@ -105,6 +264,7 @@ class Intel8086 {
     int  pop();
     void push(int val);
     int  portIn(int w, int port);
+    int  pollStatus();
     void portOut(int w, int port, int val);
 
     void show_info(int op);
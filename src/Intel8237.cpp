@@ -1,5 +1,21 @@
 #include "Intel8237.h"
 
+void Intel8237::saveState(State &st)
+{
+    for (int i = 0; i < 4; ++i) {
+        st.addr[i]     = addr[i];
+        st.cnt[i]      = cnt[i];
+        st.flipflop[i] = flipflop[i];
+    }
+}
+void Intel8237::loadState(const State &st)
+{
+    for (int i = 0; i < 4; ++i) {
+        addr[i]     = st.addr[i];
+        cnt[i]      = st.cnt[i];
+        flipflop[i] = st.flipflop[i];
+    }
+}
 bool Intel8237::isConnected(int port)
 {
     return 0x00 <= port && port < 0x20;
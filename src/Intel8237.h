@@ -3,12 +3,23 @@
 #include <vector>
 
 class Intel8237 : public Peripheral {
+  public:
+    struct State
+    {
+        int  addr[4];
+        int  cnt[4];
+        bool flipflop[4];
+    };
+
   private:
     std::vector<int>  addr     = std::vector<int>(4);
     std::vector<int>  cnt      = std::vector<int>(4);
     std::vector<bool> flipflop = std::vector<bool>(4);
 
   public:
+    void saveState(State &st);
+    void loadState(const State &st);
+
     bool isConnected(int port) override;
     int  portIn(int w, int port) override;
     void portOut(int w, int port, int val) override;
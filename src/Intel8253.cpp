@@ -1,11 +1,34 @@
 #include "Intel8253.h"
+#include <climits>
 
 Intel8253::Intel8253(Intel8259 *pic) : pic(pic)
 {
 }
-Intel8253::~Intel8253()
+void Intel8253::saveState(State &st)
 {
-    delete pic;
+    for (int sc = 0; sc < 3; ++sc) {
+        st.count[sc]         = count[sc];
+        st.value[sc]         = value[sc];
+        st.latch[sc]         = latch[sc];
+        st.control[sc]       = control[sc];
+        st.enabled[sc]       = enabled[sc];
+        st.latched[sc]       = latched[sc];
+        st.output_status[sc] = output_status[sc];
+        st.toggle[sc]        = toggle[sc];
+    }
+}
+void Intel8253::loadState(const State &st)
+{
+    for (int sc = 0; sc < 3; ++sc) {
+        count[sc]         = st.count[sc];
+        value[sc]         = st.value[sc];
+        latch[sc]         = st.latch[sc];
+        control[sc]       = st.control[sc];
+        enabled[sc]       = st.enabled[sc];
+        latched[sc]       = st.latched[sc];
+        output_status[sc] = st.output_status[sc];
+        toggle[sc]        = st.toggle[sc];
+    }
 }
 bool Intel8253::isConnected(int port)
 {
@@ -105,43 +128,142 @@ void Intel8253::tick()
 {
     for (int sc = 0b00; sc < 0b11; ++sc) {
         if (enabled[sc]) {
-            switch (control[sc] >> 1 & 0b111) {
-                {
-                    case 0b00:
-                        count[sc] = --count[sc] & 0xffff;
-                        if (count[sc] == 0) {
-                            output(sc, true);
-                        }
-                        break;
-                    case 0b10:
-                        count[sc] = --count[sc] & 0xffff;
-
-                        if (count[sc] == 1) {
-                            count[sc] = value[sc];
-                            output(sc, false);
-                        } else {
-                            output(sc, true);
-                        }
-                        break;
-                    case 0b11:
+            step(sc);
+        }
+    }
+}
+void Intel8253::step(int sc)
+{
+    switch (control[sc] >> 1 & 0b111) {
+        case 0b00:
+            count[sc] = --count[sc] & 0xffff;
+            if (count[sc] == 0) {
+                output(sc, true);
+            }
+            break;
+        case 0b10:
+            count[sc] = --count[sc] & 0xffff;
 
-                        if ((count[sc] & 0b1) == 0b1) {
-                            if (output_status[sc]) {
-                                count[sc] = count[sc] - 1 & 0xffff;
-                            } else {
-                                count[sc] = count[sc] - 3 & 0xffff;
-                            }
-                        } else {
-                            count[sc] = count[sc] - 2 & 0xffff;
-                        }
+            if (count[sc] == 1) {
+                count[sc] = value[sc];
+                output(sc, false);
+            } else {
+                output(sc, true);
+            }
+            break;
+        case 0b11:
 
-                        if (count[sc] == 0) {
-                            count[sc] = value[sc];
-                            output(sc, !output_status[sc]);
-                        }
-                        break;
+            if ((count[sc] & 0b1) == 0b1) {
+                if (output_status[sc]) {
+                    count[sc] = count[sc] - 1 & 0xffff;
+                } else {
+                    count[sc] = count[sc] - 3 & 0xffff;
                 }
+            } else {
+                count[sc] = count[sc] - 2 & 0xffff;
             }
+
+            if (count[sc] == 0) {
+                count[sc] = value[sc];
+                output(sc, !output_status[sc]);
+            }
+            break;
+    }
+}
+long long Intel8253::untilTerminal(int sc)
+{
+    const int c = count[sc];
+    switch (control[sc] >> 1 & 0b111) {
+        case 0b00:
+            return c == 0 ? 0x10000 : c;
+        case 0b10:
+            return (c - 1 & 0xffff) == 0 ? 0x10000 : c - 1 & 0xffff;
+        case 0b11: {
+            if ((c & 0b1) == 0) {
+                return c == 0 ? 0x8000 : c / 2;
+            }
+            // The first tick of an odd count takes 1 or 3 off, then 2 each.
+            const int rest = c - (output_status[sc] ? 1 : 3) & 0xffff;
+            return 1 + rest / 2;
         }
+        default:
+            return LLONG_MAX;
+    }
+}
+void Intel8253::countDown(int sc, long long n)
+{
+    if (n == 0) {
+        return;
+    }
+    switch (control[sc] >> 1 & 0b111) {
+        case 0b00:
+            count[sc] = count[sc] - n & 0xffff;
+            break;
+        case 0b10:
+            count[sc] = count[sc] - n & 0xffff;
+            output(sc, true);
+            break;
+        case 0b11:
+            if ((count[sc] & 0b1) == 0b1) {
+                count[sc] = count[sc] - (output_status[sc] ? 1 : 3) & 0xffff;
+                --n;
+            }
+            count[sc] = count[sc] - 2 * n & 0xffff;
+            break;
+    }
+}
+void Intel8253::advance(int sc, long long n)
+{
+    // From one terminal count on a counter repeats itself, so whole periods
+    // are skipped: 65536 ticks in mode 0, one reload in mode 2 and two in
+    // mode 3.
+    bool      seen   = false;
+    int       first  = 0;
+    bool      level  = false;
+    long long period = 0;
+    while (n > 0) {
+        const long long terminal = untilTerminal(sc);
+        if (n < terminal) {
+            countDown(sc, n);
+            return;
+        }
+        countDown(sc, terminal - 1);
+        step(sc);
+        n -= terminal;
+        if (!seen) {
+            seen  = true;
+            first = count[sc];
+            level = output_status[sc];
+        } else {
+            period += terminal;
+            if (count[sc] == first && output_status[sc] == level) {
+                n %= period;
+            }
+        }
+    }
+}
+void Intel8253::skip(long long n)
+{
+    for (int sc = 0b00; sc < 0b11; ++sc) {
+        if (enabled[sc]) {
+            advance(sc, n);
+        }
+    }
+}
+long long Intel8253::ticksToIrq()
+{
+    // A lower bound: the rising edge of counter 0 may come later.
+    if (!enabled[0]) {
+        return LLONG_MAX;
+    }
+    switch (control[0] >> 1 & 0b111) {
+        case 0b00:
+            return output_status[0] ? LLONG_MAX : untilTerminal(0);
+        case 0b10:
+            return output_status[0] ? untilTerminal(0) + 1 : 1;
+        case 0b11:
+            return untilTerminal(0);
+        default:
+            return LLONG_MAX;
     }
 }
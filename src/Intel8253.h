@@ -4,6 +4,19 @@
 #include <vector>
 
 class Intel8253 : public Peripheral {
+  public:
+    struct State
+    {
+        int  count[3];
+        int  value[3];
+        int  latch[3];
+        int  control[3];
+        bool enabled[3];
+        bool latched[3];
+        bool output_status[3];
+        bool toggle[3];
+    };
+
   private:
     Intel8259        *pic;
     std::vector<int>  count         = std::vector<int>(3);
@@ -17,14 +30,28 @@ class Intel8253 : public Peripheral {
 
   private:
     void output(int sc, bool state);
+    void step(int sc);
+
+    // Ticks until the next tick of counter sc that reaches terminal count,
+    // or LLONG_MAX if it never does.
+    long long untilTerminal(int sc);
+    void      countDown(int sc, long long n);
+    void      advance(int sc, long long n);
 
   public:
     Intel8253(Intel8259 *pic);
-    ~Intel8253();
+
+    void saveState(State &st);
+    void loadState(const State &st);
 
     bool isConnected(int port) override;
     int  portIn(int w, int port) override;
     void portOut(int w, int port, int val) override;
 
     virtual void tick();
+
+    // Same as n calls to tick(), in a few steps per counter. Callers keep n
+    // within ticksToIrq() so no timer interrupt is passed over.
+    void      skip(long long n);
+    long long ticksToIrq();
 };
@@ -4,15 +4,30 @@ Intel8255::Intel8255(Intel8259 *pic) : pic(pic)
 {
     ports[0] = 0x2c;
 }
-Intel8255::~Intel8255()
+void Intel8255::saveState(State &st)
 {
-    delete pic;
+    for (int i = 0; i < 4; ++i) {
+        st.ports[i] = ports[i];
+    }
+    st.key_latched = keyLatched;
+}
+void Intel8255::loadState(const State &st)
+{
+    for (int i = 0; i < 4; ++i) {
+        ports[i] = st.ports[i];
+    }
+    keyLatched = st.key_latched != 0;
 }
 void Intel8255::keyTyped(int scanCode)
 {
-    ports[0] = scanCode;
+    ports[0]   = scanCode;
+    keyLatched = true;
     pic->callIRQ(1);
 }
+bool Intel8255::keyReady()
+{
+    return !keyLatched;
+}
 bool Intel8255::isConnected(int port)
 {
     return port >= 0x60 && port < 0x64;
@@ -23,5 +38,9 @@ int Intel8255::portIn(int w, int port)
 }
 void Intel8255::portOut(int w, int port, int val)
 {
+    if ((port & 0b11) == 1 && (ports[1] & 0x80) != 0 && (val & 0x80) == 0) {
+        // End of the acknowledge pulse: the keyboard may send again.
+        keyLatched = false;
+    }
     ports[port & 0b11] = val;
 }
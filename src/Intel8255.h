@@ -4,15 +4,30 @@
 #include <vector>
 
 class Intel8255 : public Peripheral {
+  public:
+    struct State
+    {
+        int ports[4];
+        int key_latched;
+    };
+
   private:
     Intel8259       *pic;
     std::vector<int> ports = std::vector<int>(4);
 
+    // A scancode sits in port A until the keyboard interrupt handler
+    // acknowledges it by pulsing port B bit 7; the keyboard holds on to
+    // the next one until then.
+    bool keyLatched = false;
+
   public:
     Intel8255(Intel8259 *pic);
-    ~Intel8255();
+
+    void saveState(State &st);
+    void loadState(const State &st);
 
     virtual void keyTyped(int scanCode);
+    bool         keyReady();
 
     bool isConnected(int port) override;
     int  portIn(int w, int port) override;
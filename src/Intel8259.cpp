@@ -1,12 +1,40 @@
 #include "Intel8259.h"
 
+void Intel8259::saveState(State &st)
+{
+    st.imr     = imr;
+    st.irr     = irr;
+    st.isr     = isr;
+    st.icwStep = icwStep;
+    for (int i = 0; i < 4; ++i) {
+        st.icw[i] = icw[i];
+    }
+}
+void Intel8259::loadState(const State &st)
+{
+    imr     = st.imr;
+    irr     = st.irr;
+    isr     = st.isr;
+    icwStep = st.icwStep;
+    for (int i = 0; i < 4; ++i) {
+        icw[i] = st.icw[i];
+    }
+}
 void Intel8259::callIRQ(int line)
 {
     irr |= 1 << line;
 }
 bool Intel8259::hasInt()
 {
-    return (irr & ~imr) > 0;
+    return pending() != 0;
+}
+int Intel8259::pending()
+{
+    // Fully nested mode: a request waits while a line of the same or higher
+    // priority is in service.
+    const int bits   = irr & ~imr;
+    const int served = isr & -isr;
+    return served != 0 ? bits & (served - 1) : bits;
 }
 bool Intel8259::isConnected(int port)
 {
@@ -14,7 +42,7 @@ bool Intel8259::isConnected(int port)
 }
 int Intel8259::nextInt()
 {
-    int bits = irr & ~imr;
+    int bits = pending();
     for (int i = 0; i < 8; ++i) {
         if ((bits >> i & 0b1) > 0) {
             {
@@ -47,11 +75,9 @@ void Intel8259::portOut(int w, int port, int val)
             }
             if ((val & 0x20) > 0)    // EOI
             {
-                for (int i = 0; i < 8; ++i) {
-                    if ((isr >> i & 0b1) > 0) {
-                        isr ^= 1 << i;
-                    }
-                }
+                // Specific EOI names the line; otherwise end the highest
+                // priority one in service.
+                isr &= (val & 0x40) > 0 ? ~(1 << (val & 0b111)) : isr - 1;
             }
             break;
         case 0x21:
@@ -3,6 +3,16 @@
 #include <vector>
 
 class Intel8259 : public Peripheral {
+  public:
+    struct State
+    {
+        int imr;
+        int irr;
+        int isr;
+        int icwStep;
+        int icw[4];
+    };
+
   private:
     int              imr     = 0;
     int              irr     = 0;
@@ -11,6 +21,9 @@ class Intel8259 : public Peripheral {
     std::vector<int> icw     = std::vector<int>(4);
 
   public:
+    void saveState(State &st);
+    void loadState(const State &st);
+
     virtual void callIRQ(int line);
     virtual bool hasInt();
     virtual int  nextInt();
@@ -18,4 +31,7 @@ class Intel8259 : public Peripheral {
     bool isConnected(int port) override;
     int  portIn(int w, int port) override;
     void portOut(int w, int port, int val) override;
+
+  private:
+    int pending();
 };
@@ -0,0 +1,120 @@
+#include "Machine.h"
+#include "Peripheral.h"
+
+class Machine::PortHook : public Peripheral {
+  private:
+    int       first;
+    int       last;
+    PortRead  read;
+    PortWrite write;
+
+  public:
+    PortHook(int first, int last, PortRead read, PortWrite write)
+        : first(first), last(last), read(std::move(read)), write(std::move(write))
+    {
+    }
+    bool isConnected(int port) override
+    {
+        return port >= first && port <= last;
+    }
+    int portIn(int w, int port) override
+    {
+        return read ? read(port, w + 1) : 0;
+    }
+    void portOut(int w, int port, int val) override
+    {
+        if (write) {
+            write(port, w + 1, val);
+        }
+    }
+};
+
+Machine::Machine() : Machine(Config())
+{
+}
+Machine::Machine(const Config &config) : m_config(config), m_cpu(new Intel8086())
+{
+    m_cpu->init(config.bios, config.basic);
+}
+Machine::~Machine()
+{
+}
+std::unique_ptr<Machine> Machine::fork()
+{
+    std::unique_ptr<Machine> child(new Machine(m_config));
+    child->m_cpu->fork(*m_cpu);
+    return child;
+}
+long long Machine::run(long long instructions)
+{
+    const long long start = m_cpu->get_cycles();
+    m_cpu->run_until(LLONG_MAX, start + instructions);
+    return m_cpu->get_cycles() - start;
+}
+long long Machine::run_for(int ms, long long instructions)
+{
+    return run_ticks((long long)ms * Intel8086::PIT_HZ / 1000, instructions);
+}
+long long Machine::run_ticks(long long ticks, long long instructions)
+{
+    const long long start = m_cpu->get_cycles();
+    m_cpu->run_until(m_cpu->get_ticks() + ticks, instructions > LLONG_MAX - start ? LLONG_MAX : start + instructions);
+    return m_cpu->get_cycles() - start;
+}
+long long Machine::instructions()
+{
+    return m_cpu->get_cycles();
+}
+long long Machine::ticks()
+{
+    return m_cpu->get_ticks();
+}
+bool Machine::stopped()
+{
+    return m_cpu->halted() && (m_cpu->get_register(Intel8086::REG_FLAGS) & 0x200) == 0;
+}
+long long Machine::idle_ticks()
+{
+    return m_cpu->ticks_to_wake();
+}
+int Machine::get_register(Register reg)
+{
+    return m_cpu->get_register(reg);
+}
+void Machine::set_register(Register reg, int val)
+{
+    m_cpu->set_register(reg, val);
+}
+int Machine::read_byte(int addr)
+{
+    return m_cpu->read_byte(addr);
+}
+void Machine::write_byte(int addr, int val)
+{
+    m_cpu->write_byte(addr, val);
+}
+void Machine::read_memory(int addr, uint8_t *out, size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        out[i] = m_cpu->read_byte(addr + (int)i);
+    }
+}
+void Machine::write_memory(int addr, const uint8_t *data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        m_cpu->write_byte(addr + (int)i, data[i]);
+    }
+}
+void Machine::hook_ports(int first, int last, PortRead read, PortWrite write)
+{
+    m_port_hooks.emplace_back(new PortHook(first, last, std::move(read), std::move(write)));
+    m_cpu->map_ports(m_port_hooks.back().get(), first, last);
+}
+void Machine::hook_memory(int first, int last, MemoryRead read, MemoryWrite write)
+{
+    m_cpu->hook_memory(first, last, std::move(read), std::move(write));
+}
+Intel8086 *Machine::cpu()
+{
+    return m_cpu.get();
+}
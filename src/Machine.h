@@ -0,0 +1,82 @@
+#pragma once
+#include "Intel8086.h"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Embedding interface to one emulated IBM PC. Machines share nothing but
+// read-only ROM images, so any number of them can run side by side; each one
+// must only be used by one thread at a time. Callbacks run on the thread
+// that called run().
+class Machine {
+  public:
+    struct Config
+    {
+        std::string bios  = "bin/bios.bin";
+        std::string basic = "bin/basic.bin";    // empty for none
+    };
+
+    using Register    = Intel8086::Register;
+    using PortRead    = std::function<int(int port, int width)>;
+    using PortWrite   = std::function<void(int port, int width, int val)>;
+    using MemoryRead  = Intel8086::MemoryRead;
+    using MemoryWrite = Intel8086::MemoryWrite;
+
+  private:
+    class PortHook;
+
+    Config                                 m_config;
+    std::unique_ptr<Intel8086>             m_cpu;
+    std::vector<std::unique_ptr<PortHook>> m_port_hooks;
+
+  public:
+    Machine();
+    explicit Machine(const Config &config);
+    ~Machine();
+
+    Machine(const Machine &)            = delete;
+    Machine &operator=(const Machine &) = delete;
+
+    // A new machine in the state of this one, with the same ROMs and its RAM
+    // shared copy-on-write. Hooks are not carried over. This machine must
+    // outlive its forks, and not run or change memory again while any of
+    // them is alive.
+    std::unique_ptr<Machine> fork();
+
+    // Run up to the given number of instructions, or of milliseconds or PIT
+    // ticks of emulated time (and at most instructions of them); all return
+    // the number of instructions run.
+    long long run(long long instructions);
+    long long run_for(int ms, long long instructions = LLONG_MAX);
+    long long run_ticks(long long ticks, long long instructions = LLONG_MAX);
+
+    long long instructions();
+    long long ticks();
+
+    // Halted with interrupts disabled: run() has nothing left to do.
+    bool stopped();
+
+    // Halted with interrupts enabled: PIT ticks before the timer can wake
+    // it, at least; 0 if it is running and LLONG_MAX if no timer will.
+    long long idle_ticks();
+
+    int  get_register(Register reg);
+    void set_register(Register reg, int val);
+
+    int  read_byte(int addr);
+    void write_byte(int addr, int val);
+    void read_memory(int addr, uint8_t *out, size_t size);
+    void write_memory(int addr, const uint8_t *data, size_t size);
+
+    // Port callbacks get the width of the access in bytes, 1 or 2. A null
+    // read callback reads 0, a null write callback drops the value.
+    void hook_ports(int first, int last, PortRead read, PortWrite write);
+    void hook_memory(int first, int last, MemoryRead read, MemoryWrite write);
+
+    // The machine itself, for TextScreen, Typist and snapshots.
+    Intel8086 *cpu();
+};
@@ -1,9 +1,96 @@
 #include "Motorola6845.h"
 
+Motorola6845::Motorola6845(const long long *ticks) : ticks(ticks)
+{
+}
+void Motorola6845::saveState(State &st)
+{
+    st.index = index;
+    for (int i = 0; i < 0x10; ++i) {
+        st.registers[i] = registers[i];
+    }
+    st.mode  = mode;
+    st.color = color;
+}
+void Motorola6845::loadState(const State &st)
+{
+    index = st.index;
+    for (int i = 0; i < 0x10; ++i) {
+        registers[i] = st.registers[i];
+    }
+    mode  = st.mode;
+    color = st.color;
+}
 int Motorola6845::getRegister(int index)
 {
     return registers[index];
 }
+int Motorola6845::getMode()
+{
+    return mode;
+}
+int Motorola6845::getColor()
+{
+    return color;
+}
+int Motorola6845::getStatus()
+{
+    Timing t;
+    getTiming(t);
+    return statusAt(t, *ticks * DOTS_PER_TICK);
+}
+long long Motorola6845::nextEdge(int mask)
+{
+    Timing t;
+    getTiming(t);
+    const long long now    = *ticks * DOTS_PER_TICK;
+    const int       status = statusAt(t, now) & mask;
+
+    // The status can only change where the displayed part of a scan line
+    // ends or where a scan line ends.
+    long long dot = now;
+    for (int i = 0; i < 2 * t.lines; ++i) {
+        const int x = dot % t.line;
+        dot += x < t.hdisp ? t.hdisp - x : t.line - x;
+        if ((statusAt(t, dot) & mask) != status) {
+            return (dot + DOTS_PER_TICK - 1) / DOTS_PER_TICK;
+        }
+    }
+    return *ticks + 1;
+}
+void Motorola6845::getTiming(Timing &t)
+{
+    if (registers[0] == 0) {
+        // Not programmed yet: 80x25 text timing.
+        t = {912, 640, 262, 200, 224};
+        return;
+    }
+    const int char_dots = (mode & MODE_80COL) != 0 ? 8 : 16;
+    const int row_lines = (registers[9] & 0x1f) + 1;
+
+    t.line  = (registers[0] + 1) * char_dots;
+    t.hdisp = registers[1] * char_dots;
+    t.lines = ((registers[4] & 0x7f) + 1) * row_lines + (registers[5] & 0x1f);
+    t.vdisp = (registers[6] & 0x7f) * row_lines;
+    t.vsync = (registers[7] & 0x7f) * row_lines;
+    if (t.hdisp > t.line) {
+        t.hdisp = t.line;
+    }
+}
+int Motorola6845::statusAt(const Timing &t, long long dot)
+{
+    const long long pos    = dot % ((long long)t.line * t.lines);
+    const int       y      = pos / t.line;
+    const int       x      = pos % t.line;
+    int             status = 0;
+    if (x >= t.hdisp || y >= t.vdisp) {
+        status |= STATUS_BLANK;
+    }
+    if (y >= t.vsync && y < t.vsync + VSYNC_LINES) {
+        status |= STATUS_VSYNC;
+    }
+    return status;
+}
 
 bool Motorola6845::isConnected(int port)
 {
@@ -14,18 +101,7 @@ int Motorola6845::portIn(int w, int port)
 {
     switch (port) {
         case 0x3da:
-            // Simulate vertical/horizontal retracing.
-            retrace = ++retrace % 4;
-            switch (retrace) {
-                case 0:
-                    return 8;    // VR started
-                case 1:
-                    return 0;    // VR ended
-                case 2:
-                    return 1;    // HR started
-                case 3:
-                    return 0;    // HR ended
-            }
+            return getStatus();
     }
     return 0;
 }
@@ -37,7 +113,15 @@ void Motorola6845::portOut(int w, int port, int val)
             index = val;
             break;
         case 0x3d5:    // Register
-            registers[index] = val;
+            if (index < 0x10) {
+                registers[index] = val;
+            }
+            break;
+        case 0x3d8:    // Mode control
+            mode = val & 0x3f;
+            break;
+        case 0x3d9:    // Color select
+            color = val & 0x3f;
             break;
     }
 }
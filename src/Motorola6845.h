@@ -3,15 +3,68 @@
 #include <vector>
 
 class Motorola6845 : public Peripheral {
+  public:
+    struct State
+    {
+        int index;
+        int registers[0x10];
+        int mode;
+        int color;
+    };
+
+    // Mode control register bits, port 0x3d8.
+    static const int MODE_80COL    = 0b000001;
+    static const int MODE_GRAPHICS = 0b000010;
+    static const int MODE_MONO     = 0b000100;
+    static const int MODE_ENABLE   = 0b001000;
+    static const int MODE_HIRES    = 0b010000;
+    static const int MODE_BLINK    = 0b100000;
+
+    // Status register bits, port 0x3da.
+    static const int STATUS_BLANK = 0b0001;    // beam outside the displayed area
+    static const int STATUS_VSYNC = 0b1000;    // vertical retrace
+
   private:
+    // The 14.318 MHz dot clock runs at 12 times the PIT clock.
+    static const int DOTS_PER_TICK = 12;
+    static const int VSYNC_LINES   = 16;
+
+    // Raster geometry in dots and scan lines, from the timing registers.
+    struct Timing
+    {
+        int line;     // dots per scan line
+        int hdisp;    // displayed dots per scan line
+        int lines;    // scan lines per frame
+        int vdisp;    // displayed scan lines
+        int vsync;    // first scan line of vertical retrace
+    };
+
+    const long long *ticks;
     int              index     = 0;
     std::vector<int> registers = std::vector<int>(0x10);
-    int              retrace   = 0;
+    int              mode      = MODE_BLINK | MODE_ENABLE | MODE_80COL;
+    int              color     = 0;
 
   public:
+    Motorola6845(const long long *ticks);
+
+    void saveState(State &st);
+    void loadState(const State &st);
+
     virtual int getRegister(int index);
+    int         getMode();
+    int         getColor();
+
+    // Status from the beam position at the current PIT tick, and the tick at
+    // which the bits in mask next change.
+    int       getStatus();
+    long long nextEdge(int mask);
 
     bool isConnected(int port) override;
     int  portIn(int w, int port) override;
     void portOut(int w, int port, int val) override;
+
+  private:
+    void getTiming(Timing &t);
+    int  statusAt(const Timing &t, long long dot);
 };
@@ -2,49 +2,41 @@
 #include "Intel8086.h"
 #include "Intel8255.h"
 #include "Motorola6845.h"
+#include "Rasterizer.h"
+#include "Recorder.h"
+#include "Rewind.h"
+#include <climits>
 #include <cstdint>
 #include <cstdio>
-
-std::vector<uint16_t> MAPPING = {
-    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d,
-    0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b,
-    0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
-    0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
-    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
-    0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
-    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061,
-    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
-    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d,
-    0x007e, 0x007f, 0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x00e0, 0x00e5, 0x00e7, 0x00ea, 0x00eb, 0x00e8, 0x00ef,
-    0x00ee, 0x00ec, 0x00c4, 0x00c5, 0x00c9, 0x00e6, 0x00c6, 0x00f4, 0x00f6, 0x00f2, 0x00fb, 0x00f9, 0x00ff, 0x00d6,
-    0x00dc, 0x00a2, 0x00a3, 0x00a5, 0x20a7, 0x0192, 0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x00f1, 0x00d1, 0x00aa, 0x00ba,
-    0x00bf, 0x2310, 0x00ac, 0x00bd, 0x00bc, 0x00a1, 0x00ab, 0x00bb, 0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561,
-    0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255d, 0x255c, 0x255b, 0x2510, 0x2514, 0x2534, 0x252c, 0x251c,
-    0x2500, 0x253c, 0x255e, 0x255f, 0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x2567, 0x2568, 0x2564,
-    0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256b, 0x256a, 0x2518, 0x250c, 0x2588, 0x2584, 0x258c, 0x2590, 0x2580,
-    0x03b1, 0x00df, 0x0393, 0x03c0, 0x03a3, 0x03c3, 0x00b5, 0x03c4, 0x03a6, 0x0398, 0x03a9, 0x03b4, 0x221e, 0x03c6,
-    0x03b5, 0x2229, 0x2261, 0x00b1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00f7, 0x2248, 0x00b0, 0x2219, 0x00b7, 0x221a,
-    0x207f, 0x00b2, 0x25a0, 0x0020};
-
-std::vector<std::vector<uint8_t>> COLORS = {{0, 0, 0},     {0, 0, 170},    {0, 170, 0},    {0, 170, 170},
-                                            {170, 0, 0},   {170, 0, 170},  {170, 85, 0},   {170, 170, 170},
-                                            {85, 85, 85},  {85, 85, 255},  {85, 255, 85},  {85, 255, 255},
-                                            {255, 85, 85}, {255, 85, 255}, {255, 255, 85}, {255, 255, 255}};
+#include <cstring>
+#include <memory>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 PC::PC()
 {
     m_cpu = new Intel8086();
     m_cpu->init();
 
-    TTF_Init();
-    font = TTF_OpenFont("bin/cp437.ttf", 12);
-    if (font == NULL) {
-        printf("error: font not found\n");
-        exit(EXIT_FAILURE);
-    }
+    m_frame_event = SDL_RegisterEvents(1);
 }
 PC::~PC()
 {
+    if (m_atlas != nullptr) {
+        SDL_DestroyTexture(m_atlas);
+    }
+    if (m_screen != nullptr) {
+        SDL_DestroyTexture(m_screen);
+    }
+    if (m_stream != nullptr) {
+        SDL_DestroyTexture(m_stream);
+    }
+    delete m_raster;
+    delete m_recorder;
+    delete m_replayer;
+    delete m_rewind;
+    delete m_host;
     delete m_cpu;
 }
 void PC::reset()
@@ -53,58 +45,441 @@ void PC::reset()
 }
 void PC::run_cpu()
 {
-    m_cpu->run();
+    // One slice of emulated time, cut short at the next frame or replayed
+    // input event so both land on their exact tick or instruction.
+    const long long slice_end   = m_cpu->get_ticks() + SLICE_TICKS;
+    long long       tick_limit  = slice_end < m_next_frame ? slice_end : m_next_frame;
+    long long       cycle_limit = LLONG_MAX;
+    if (m_replayer != nullptr) {
+        m_replayer->poll();
+        m_replayer->limit(tick_limit, cycle_limit);
+    }
+    int scancode;
+    if (m_cpu->m_ppi->keyReady() && m_keys.pop(scancode)) {
+        deliverKey(scancode);
+    }
+    m_cpu->run_until(tick_limit, cycle_limit);
+    if (m_rewind != nullptr) {
+        m_rewind->poll();
+    }
+    if (m_cpu->get_ticks() >= m_next_frame) {
+        publishFrame();
+    }
+    m_throttle.pace(m_cpu->get_ticks());
+}
+void PC::set_speed(double multiple)
+{
+    m_throttle.set_speed(multiple);
+}
+Throttle::Stats PC::speed_stats()
+{
+    return m_throttle.stats();
 }
-void PC::paint(SDL_Renderer *renderer, int widht, int height)
+void PC::publishFrame()
 {
-    const int curAttr = m_cpu->m_crtc->getRegister(0xa) >> 4;
-    const int curLoc  = m_cpu->m_crtc->getRegister(0xf) | m_cpu->m_crtc->getRegister(0xe) << 8;
+    // CGA refreshes at 59.92 Hz.
+    static const long long FRAME_TICKS = Intel8086::PIT_HZ * 100LL / 5992;
 
-    SDL_RenderClear(renderer);
+    m_next_frame = m_cpu->get_ticks() + FRAME_TICKS;
+
+    // Unchanged screens are not published, so the UI thread stays asleep.
+    VideoFrame &frame = m_frames.back();
+    frame.capture(m_cpu);
+    if (memcmp(frame.versions, m_shown_versions, sizeof(m_shown_versions)) == 0 &&
+        memcmp(frame.crtc, m_shown_crtc, sizeof(m_shown_crtc)) == 0 && frame.mode == m_shown_mode &&
+        frame.color == m_shown_color) {
+        return;
+    }
+    memcpy(m_shown_versions, frame.versions, sizeof(m_shown_versions));
+    memcpy(m_shown_crtc, frame.crtc, sizeof(m_shown_crtc));
+    m_shown_mode  = frame.mode;
+    m_shown_color = frame.color;
 
-    for (int y = 0; y < 25; ++y) {
-        for (int x = 0; x < 80; ++x) {
-            const uint8_t  character = m_cpu->m_memory[0xb8000 + 2 * (x + y * 80)];
-            const uint16_t attribute = m_cpu->m_memory[0xb8000 + 2 * (x + y * 80) + 1];
-
-            // --- bg
-            auto gbcolor = COLORS[attribute >> 4 & 0b111];
-            SDL_SetRenderDrawColor(renderer, gbcolor[0], gbcolor[1], gbcolor[2], SDL_ALPHA_OPAQUE);
-            SDL_Rect rect;
-            rect.x = x * 7;
-            rect.y = y * 12;
-            rect.w = 7;
-            rect.h = 12;
-            SDL_RenderFillRect(renderer, &rect);
-
-            // --- font
-            if (character != 0 && character != 32) {
-                // printf("%s", character);
-                auto      fntcolor = COLORS[attribute & 0b1111];
-                SDL_Color color    = {fntcolor[0], fntcolor[1], fntcolor[2]};
-
-                SDL_Rect r0;
-                r0.x = 0;
-                r0.y = 0;
-                r0.w = 7;
-                r0.h = 12;
-
-                SDL_Rect r1;
-                r1.x = x * 7;
-                r1.y = y * 12;
-                r1.w = 7;
-                r1.h = 12;
-
-                const uint16_t chr          = MAPPING[character];
-                SDL_Surface   *text_surface = TTF_RenderUNICODE_Solid(font, &chr, color);
-                SDL_Texture   *Message      = SDL_CreateTextureFromSurface(renderer, text_surface);
-
-                SDL_RenderCopy(renderer, Message, &r0, &r1);
-                SDL_FreeSurface(text_surface);
-                SDL_DestroyTexture(Message);
+    frame.sequence = ++m_frame_sequence;
+    m_frames.publish();
+
+    // One wakeup is enough however many frames arrive before the UI thread
+    // gets to them; it always picks up the latest.
+    if (!m_frame_pending.exchange(true)) {
+        SDL_Event event{};
+        event.type = m_frame_event;
+        SDL_PushEvent(&event);
+    }
+}
+void PC::capture_screen(const std::string &path)
+{
+    // Called between instructions on the CPU thread; draws the live machine.
+    std::unique_ptr<VideoFrame> frame(new VideoFrame());
+    frame->capture(m_cpu);
+    Rasterizer raster(*m_font);
+    raster.draw(*frame);
+    raster.save_ppm(path);
+}
+// XT keyboard scancodes (set 1) by key position. Keys the 83-key keyboard
+// lacks map to the key that has the same function there.
+static const struct
+{
+    SDL_Scancode key;
+    uint8_t      xt;
+} KEYMAP[] = {
+    {SDL_SCANCODE_ESCAPE, 0x01},         {SDL_SCANCODE_1, 0x02},              {SDL_SCANCODE_2, 0x03},
+    {SDL_SCANCODE_3, 0x04},              {SDL_SCANCODE_4, 0x05},              {SDL_SCANCODE_5, 0x06},
+    {SDL_SCANCODE_6, 0x07},              {SDL_SCANCODE_7, 0x08},              {SDL_SCANCODE_8, 0x09},
+    {SDL_SCANCODE_9, 0x0a},              {SDL_SCANCODE_0, 0x0b},              {SDL_SCANCODE_MINUS, 0x0c},
+    {SDL_SCANCODE_EQUALS, 0x0d},         {SDL_SCANCODE_BACKSPACE, 0x0e},      {SDL_SCANCODE_TAB, 0x0f},
+    {SDL_SCANCODE_Q, 0x10},              {SDL_SCANCODE_W, 0x11},              {SDL_SCANCODE_E, 0x12},
+    {SDL_SCANCODE_R, 0x13},              {SDL_SCANCODE_T, 0x14},              {SDL_SCANCODE_Y, 0x15},
+    {SDL_SCANCODE_U, 0x16},              {SDL_SCANCODE_I, 0x17},              {SDL_SCANCODE_O, 0x18},
+    {SDL_SCANCODE_P, 0x19},              {SDL_SCANCODE_LEFTBRACKET, 0x1a},    {SDL_SCANCODE_RIGHTBRACKET, 0x1b},
+    {SDL_SCANCODE_RETURN, 0x1c},         {SDL_SCANCODE_KP_ENTER, 0x1c},       {SDL_SCANCODE_LCTRL, 0x1d},
+    {SDL_SCANCODE_RCTRL, 0x1d},          {SDL_SCANCODE_A, 0x1e},              {SDL_SCANCODE_S, 0x1f},
+    {SDL_SCANCODE_D, 0x20},              {SDL_SCANCODE_F, 0x21},              {SDL_SCANCODE_G, 0x22},
+    {SDL_SCANCODE_H, 0x23},              {SDL_SCANCODE_J, 0x24},              {SDL_SCANCODE_K, 0x25},
+    {SDL_SCANCODE_L, 0x26},              {SDL_SCANCODE_SEMICOLON, 0x27},      {SDL_SCANCODE_APOSTROPHE, 0x28},
+    {SDL_SCANCODE_GRAVE, 0x29},          {SDL_SCANCODE_LSHIFT, 0x2a},         {SDL_SCANCODE_BACKSLASH, 0x2b},
+    {SDL_SCANCODE_NONUSBACKSLASH, 0x2b}, {SDL_SCANCODE_Z, 0x2c},              {SDL_SCANCODE_X, 0x2d},
+    {SDL_SCANCODE_C, 0x2e},              {SDL_SCANCODE_V, 0x2f},              {SDL_SCANCODE_B, 0x30},
+    {SDL_SCANCODE_N, 0x31},              {SDL_SCANCODE_M, 0x32},              {SDL_SCANCODE_COMMA, 0x33},
+    {SDL_SCANCODE_PERIOD, 0x34},         {SDL_SCANCODE_SLASH, 0x35},          {SDL_SCANCODE_KP_DIVIDE, 0x35},
+    {SDL_SCANCODE_RSHIFT, 0x36},         {SDL_SCANCODE_KP_MULTIPLY, 0x37},    {SDL_SCANCODE_PRINTSCREEN, 0x37},
+    {SDL_SCANCODE_LALT, 0x38},           {SDL_SCANCODE_RALT, 0x38},           {SDL_SCANCODE_SPACE, 0x39},
+    {SDL_SCANCODE_CAPSLOCK, 0x3a},       {SDL_SCANCODE_F1, 0x3b},             {SDL_SCANCODE_F2, 0x3c},
+    {SDL_SCANCODE_F3, 0x3d},             {SDL_SCANCODE_F4, 0x3e},             {SDL_SCANCODE_F5, 0x3f},
+    {SDL_SCANCODE_F6, 0x40},             {SDL_SCANCODE_F7, 0x41},             {SDL_SCANCODE_F8, 0x42},
+    {SDL_SCANCODE_F9, 0x43},             {SDL_SCANCODE_F10, 0x44},            {SDL_SCANCODE_NUMLOCKCLEAR, 0x45},
+    {SDL_SCANCODE_SCROLLLOCK, 0x46},     {SDL_SCANCODE_KP_7, 0x47},           {SDL_SCANCODE_HOME, 0x47},
+    {SDL_SCANCODE_KP_8, 0x48},           {SDL_SCANCODE_UP, 0x48},             {SDL_SCANCODE_KP_9, 0x49},
+    {SDL_SCANCODE_PAGEUP, 0x49},         {SDL_SCANCODE_KP_MINUS, 0x4a},       {SDL_SCANCODE_KP_4, 0x4b},
+    {SDL_SCANCODE_LEFT, 0x4b},           {SDL_SCANCODE_KP_5, 0x4c},           {SDL_SCANCODE_KP_6, 0x4d},
+    {SDL_SCANCODE_RIGHT, 0x4d},          {SDL_SCANCODE_KP_PLUS, 0x4e},        {SDL_SCANCODE_KP_1, 0x4f},
+    {SDL_SCANCODE_END, 0x4f},            {SDL_SCANCODE_KP_2, 0x50},           {SDL_SCANCODE_DOWN, 0x50},
+    {SDL_SCANCODE_KP_3, 0x51},           {SDL_SCANCODE_PAGEDOWN, 0x51},       {SDL_SCANCODE_KP_0, 0x52},
+    {SDL_SCANCODE_INSERT, 0x52},         {SDL_SCANCODE_KP_PERIOD, 0x53},      {SDL_SCANCODE_DELETE, 0x53},
+};
+
+bool PC::key_typed(int scancode)
+{
+    return m_keys.push(scancode);
+}
+bool PC::key_event(const SDL_KeyboardEvent &event)
+{
+    // Held keys repeat their make code, like the keyboard's typematic.
+    for (const auto &entry : KEYMAP) {
+        if (entry.key == event.keysym.scancode) {
+            return m_keys.push(event.type == SDL_KEYUP ? entry.xt | 0x80 : entry.xt);
+        }
+    }
+    return true;
+}
+void PC::deliverKey(int scancode)
+{
+    // Live input is ignored while a log is replaying.
+    if (m_replayer != nullptr && !m_replayer->finished()) {
+        return;
+    }
+    if (m_recorder != nullptr) {
+        m_recorder->record(Recorder::EVENT_KEY, scancode);
+    }
+    m_cpu->m_ppi->keyTyped(scancode);
+}
+void PC::enable_host_control(HostControl::Exit on_exit)
+{
+    if (m_host == nullptr) {
+        m_host = new HostControl(m_cpu, std::move(on_exit));
+        m_cpu->map_ports(m_host, HostControl::PORT_FIRST, HostControl::PORT_LAST);
+    }
+}
+void PC::enable_rewind(int interval_ms, size_t capacity)
+{
+    delete m_rewind;
+    m_rewind = new Rewind(m_cpu, interval_ms, capacity);
+}
+bool PC::rewind(int snapshots)
+{
+    return m_rewind != nullptr && m_rewind->rewind(snapshots);
+}
+void PC::start_recording(const std::string &path)
+{
+    stop_recording();
+    m_recorder = new Recorder(m_cpu, path);
+}
+void PC::stop_recording()
+{
+    delete m_recorder;
+    m_recorder = nullptr;
+}
+void PC::start_replay(const std::string &path)
+{
+    delete m_replayer;
+    m_replayer = nullptr;
+    m_replayer = new Replayer(m_cpu, path);
+}
+void PC::buildAtlas(SDL_Renderer *renderer)
+{
+    if (m_atlas != nullptr) {
+        SDL_DestroyTexture(m_atlas);
+    }
+    const int    w     = m_font->width;
+    const int    h     = m_font->height;
+    SDL_Surface *sheet = SDL_CreateRGBSurfaceWithFormat(0, 16 * w, 16 * h, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_FillRect(sheet, nullptr, SDL_MapRGBA(sheet->format, 0, 0, 0, 0));
+
+    // Set glyph pixels opaque white, the rest stays transparent.
+    SDL_LockSurface(sheet);
+    for (int c = 0; c < 256; ++c) {
+        const uint8_t *glyph = m_font->glyphs + c * h;
+        for (int y = 0; y < h; ++y) {
+            uint32_t *out = (uint32_t *)((uint8_t *)sheet->pixels + (c / 16 * h + y) * sheet->pitch) + c % 16 * w;
+            for (int x = 0; x < w; ++x) {
+                if (glyph[y] >> (7 - x) & 1) {
+                    out[x] = 0xffffffff;
+                }
             }
         }
     }
+    SDL_UnlockSurface(sheet);
+    m_atlas = SDL_CreateTextureFromSurface(renderer, sheet);
+    SDL_SetTextureBlendMode(m_atlas, SDL_BLENDMODE_BLEND);
+    SDL_FreeSurface(sheet);
+    m_atlas_renderer = renderer;
+}
+void PC::drawCell(SDL_Renderer *renderer, const uint8_t *cells, int cell, int cursor_shape)
+{
+    const uint8_t  character = cells[2 * cell];
+    const uint16_t attribute = cells[2 * cell + 1];
+
+    // --- bg
+    const auto &gbcolor = CGA_PALETTE[attribute >> 4 & 0b111];
+    SDL_SetRenderDrawColor(renderer, gbcolor[0], gbcolor[1], gbcolor[2], SDL_ALPHA_OPAQUE);
+    SDL_Rect rect;
+    rect.x = cell % m_columns * m_font->width;
+    rect.y = cell / m_columns * m_font->height;
+    rect.w = m_font->width;
+    rect.h = m_font->height;
+    SDL_RenderFillRect(renderer, &rect);
+
+    // --- font
+    const auto &fntcolor = CGA_PALETTE[attribute & 0b1111];
+    if (character != 0 && character != 32) {
+        SDL_SetTextureColorMod(m_atlas, fntcolor[0], fntcolor[1], fntcolor[2]);
+
+        SDL_Rect r0 = {character % 16 * rect.w, character / 16 * rect.h, rect.w, rect.h};
+        SDL_RenderCopy(renderer, m_atlas, &r0, &rect);
+    }
+
+    // --- cursor, start and end scan lines of an 8 line CGA cell
+    if (cursor_shape >= 0) {
+        const int start = cursor_shape >> 8 & 0x1f;
+        const int end   = (cursor_shape & 0x1f) < 8 ? cursor_shape & 0x1f : 7;
+        if (start <= end) {
+            const int top    = start * rect.h / 8;
+            const int bottom = (end + 1) * rect.h / 8;
+            SDL_Rect  bar    = {rect.x, rect.y + top, rect.w, bottom - top};
+            SDL_SetRenderDrawColor(renderer, fntcolor[0], fntcolor[1], fntcolor[2], SDL_ALPHA_OPAQUE);
+            SDL_RenderFillRect(renderer, &bar);
+        }
+    }
+}
+// Compares the frame with the shadow copy, 16 bytes (8 cells) at a time, and
+// collects the indices of cells that differ. The shadow copy is updated.
+static int diffCells(const uint8_t *vram, uint8_t *shadow, int size, uint16_t *changed)
+{
+    int count = 0;
+    int i     = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; i + 16 <= size; i += 16) {
+        __m128i cur  = _mm_loadu_si128((const __m128i *)(vram + i));
+        __m128i prev = _mm_loadu_si128((const __m128i *)(shadow + i));
+        int     same = _mm_movemask_epi8(_mm_cmpeq_epi8(cur, prev));
+        if (same == 0xffff) {
+            continue;
+        }
+        for (int j = 0; j < 16; j += 2) {
+            if ((same >> j & 0b11) != 0b11) {
+                changed[count++] = (i + j) / 2;
+            }
+        }
+        _mm_storeu_si128((__m128i *)(shadow + i), cur);
+    }
+#endif
+    for (; i < size; i += 2) {
+        if (vram[i] != shadow[i] || vram[i + 1] != shadow[i + 1]) {
+            changed[count++] = i / 2;
+            shadow[i]        = vram[i];
+            shadow[i + 1]    = vram[i + 1];
+        }
+    }
+    return count;
+}
+void PC::use_software_renderer(bool enable)
+{
+    m_software   = enable;
+    m_redraw_all = true;
+}
+void PC::set_font(const Font &font)
+{
+    // Textures are rebuilt for the new cell size on the next paint.
+    m_font            = &font;
+    m_atlas_renderer  = nullptr;
+    m_stream_renderer = nullptr;
+    delete m_raster;
+    m_raster = nullptr;
+}
+int PC::screen_width()
+{
+    return COLS * m_font->width;
+}
+int PC::screen_height()
+{
+    return ROWS * m_font->height;
+}
+void PC::paintSoftware(SDL_Renderer *renderer, bool fresh)
+{
+    if (m_raster == nullptr) {
+        m_raster = new Rasterizer(*m_font);
+    }
+    if (m_stream_renderer != renderer) {
+        fresh = true;
+    }
+    if (!fresh) {
+        return;
+    }
+    m_raster->draw(*m_frame);
+
+    // Text and graphics differ in size; the texture follows the buffer.
+    int w = 0, h = 0;
+    if (m_stream != nullptr) {
+        SDL_QueryTexture(m_stream, nullptr, nullptr, &w, &h);
+    }
+    if (m_stream == nullptr || m_stream_renderer != renderer || w != m_raster->width() || h != m_raster->height()) {
+        if (m_stream != nullptr) {
+            SDL_DestroyTexture(m_stream);
+        }
+        m_stream = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                     m_raster->width(), m_raster->height());
+        m_stream_renderer = renderer;
+    }
+
+    // The whole screen goes to the GPU in one upload and one copy.
+    SDL_UpdateTexture(m_stream, nullptr, m_raster->pixels(), m_raster->pitch());
+    SDL_RenderClear(renderer);
+    SDL_RenderCopy(renderer, m_stream, nullptr, nullptr);
+    present(renderer);
+}
+void PC::set_max_fps(int fps)
+{
+    m_min_interval = fps > 0 ? 1000 / fps : 0;
+}
+uint32_t PC::frame_event()
+{
+    return m_frame_event;
+}
+void PC::repaint()
+{
+    m_redraw_all = true;
+}
+void PC::present(SDL_Renderer *renderer)
+{
     SDL_RenderPresent(renderer);
-    SDL_Delay(10);
+    m_last_present = SDL_GetTicks();
+}
+int PC::paint(SDL_Renderer *renderer, int widht, int height)
+{
+    // Runs on the UI thread: everything it draws comes from the latest
+    // frame the CPU thread published, never from the live machine. A frame
+    // published from here on sends a new wakeup.
+    m_frame_pending = false;
+
+    // Hold back frames that come faster than the refresh limit; they stay
+    // in the frame buffer until the returned delay has passed.
+    const uint32_t since = SDL_GetTicks() - m_last_present;
+    if (since < m_min_interval) {
+        return m_min_interval - since;
+    }
+
+    const VideoFrame *next = m_frames.consume();
+    if (next != nullptr) {
+        m_frame = next;
+    }
+
+    // Graphics modes are always drawn in software. A mode switch redraws
+    // the whole screen, since the cell cache is stale coming back to text.
+    const bool graphics = m_frame != nullptr && (m_frame->mode & Motorola6845::MODE_GRAPHICS) != 0;
+    if (graphics != m_graphics) {
+        m_graphics   = graphics;
+        m_redraw_all = true;
+    }
+    if (graphics || (m_frame != nullptr && m_software)) {
+        paintSoftware(renderer, next != nullptr || m_redraw_all);
+        m_redraw_all = false;
+        return -1;
+    }
+    if (m_frame == nullptr || (next == nullptr && m_atlas_renderer == renderer && !m_redraw_all)) {
+        return -1;
+    }
+
+    const int      curLoc   = m_frame->cursor();
+    const int      curShape = m_frame->cursor_shape();
+    const int      columns  = m_frame->columns();
+    const int      rows     = m_frame->rows();
+    const uint8_t *cells    = m_frame->text(m_scratch);
+
+    // A 40 column screen is half as wide and gets stretched to the window.
+    if (m_atlas == nullptr || m_atlas_renderer != renderer || columns != m_columns || rows != m_rows) {
+        if (m_atlas_renderer != renderer) {
+            buildAtlas(renderer);
+        }
+        if (m_screen != nullptr) {
+            SDL_DestroyTexture(m_screen);
+            m_screen = nullptr;
+        }
+        if (SDL_RenderTargetSupported(renderer)) {
+            m_screen = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                         columns * m_font->width, rows * m_font->height);
+        }
+        m_columns    = columns;
+        m_rows       = rows;
+        m_redraw_all = true;
+    }
+
+    uint16_t changed[VideoFrame::MAX_COLS * VideoFrame::MAX_ROWS + 2];
+    int      count = diffCells(cells, m_shadow, columns * rows * 2, changed);
+    if (curLoc != m_cursor || curShape != m_cursor_shape) {
+        if (m_cursor >= 0 && m_cursor < columns * rows) {
+            changed[count++] = m_cursor;
+        }
+        if (curLoc >= 0 && curLoc != m_cursor) {
+            changed[count++] = curLoc;
+        }
+        m_cursor       = curLoc;
+        m_cursor_shape = curShape;
+    }
+    // Without a render target the back buffer does not survive a present.
+    if (m_screen == nullptr && count > 0) {
+        m_redraw_all = true;
+    }
+
+    if (!m_redraw_all && count == 0) {
+        return -1;
+    }
+
+    SDL_SetRenderTarget(renderer, m_screen);
+    if (m_redraw_all) {
+        SDL_RenderClear(renderer);
+        for (int cell = 0; cell < columns * rows; ++cell) {
+            drawCell(renderer, cells, cell, cell == curLoc ? curShape : -1);
+        }
+        m_redraw_all = m_screen == nullptr;
+    } else {
+        for (int i = 0; i < count; ++i) {
+            drawCell(renderer, cells, changed[i], changed[i] == curLoc ? curShape : -1);
+        }
+    }
+    if (m_screen != nullptr) {
+        SDL_SetRenderTarget(renderer, nullptr);
+        SDL_RenderClear(renderer);
+        SDL_RenderCopy(renderer, m_screen, nullptr, nullptr);
+    }
+    present(renderer);
+    return -1;
 }
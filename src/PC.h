@@ -1,17 +1,84 @@
 #pragma once
+#include <atomic>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
+#include "Font.h"
+#include "FrameBuffer.h"
+#include "HostControl.h"
+#include "ScancodeQueue.h"
+#include "Throttle.h"
 
 class Intel8086;
 class Intel8255;
 class Motorola6845;
+class Rasterizer;
+class Rewind;
+class Recorder;
+class Replayer;
 
 class PC {
   private:
-    Intel8086 *m_cpu = nullptr;
-    TTF_Font  *font  = nullptr;
+    static const int COLS = 80;
+    static const int ROWS = 25;
+
+    // Emulated time run_cpu() covers per call: one millisecond.
+    static const int SLICE_TICKS = 1193;
+
+    Intel8086   *m_cpu      = nullptr;
+    const Font  *m_font     = &CGA_FONT_8X14;
+    Rewind      *m_rewind   = nullptr;
+    Recorder    *m_recorder = nullptr;
+    Replayer    *m_replayer = nullptr;
+    HostControl *m_host     = nullptr;
+
+    Throttle m_throttle;
+
+    // Keys from the UI thread, handed to the keyboard one per acknowledged
+    // interrupt.
+    ScancodeQueue m_keys;
+
+    // Video frames published by the CPU thread at each vertical retrace
+    // when the screen changed, announced with an SDL event of type
+    // m_frame_event.
+    FrameBuffer       m_frames;
+    const VideoFrame *m_frame          = nullptr;
+    long long         m_next_frame     = 0;
+    uint64_t          m_frame_sequence = 0;
+    uint32_t          m_frame_event    = 0;
+    std::atomic<bool> m_frame_pending{false};
+    uint32_t          m_shown_versions[VideoFrame::VRAM_PAGES]{};
+    int               m_shown_crtc[0x10]{};
+    int               m_shown_mode  = -1;
+    int               m_shown_color = -1;
+
+    // Present pacing, in SDL milliseconds.
+    uint32_t m_min_interval = 0;
+    uint32_t m_last_present = 0;
+
+    // All 256 glyphs in a 16x16 grid, rendered white and tinted per cell.
+    SDL_Texture  *m_atlas          = nullptr;
+    SDL_Renderer *m_atlas_renderer = nullptr;
+
+    // Last drawn frame: cells are kept in m_screen and only redrawn when
+    // their character, attribute or the cursor changes.
+    SDL_Texture *m_screen = nullptr;
+    uint8_t      m_shadow[VideoFrame::MAX_COLS * VideoFrame::MAX_ROWS * 2]{};
+    uint8_t      m_scratch[VideoFrame::VRAM_SIZE];
+    int          m_columns      = 0;
+    int          m_rows         = 0;
+    int          m_cursor       = -1;
+    int          m_cursor_shape = -1;
+    bool         m_redraw_all   = true;
+
+    // Software path: the screen is rasterized in memory and streamed to
+    // the GPU as a single texture per frame. Graphics modes always use it.
+    bool          m_software        = false;
+    bool          m_graphics        = false;
+    Rasterizer   *m_raster          = nullptr;
+    SDL_Texture  *m_stream          = nullptr;
+    SDL_Renderer *m_stream_renderer = nullptr;
 
     //
   public:
@@ -19,7 +86,51 @@ class PC {
     ~PC();
 
     void reset();
+
+    // Runs the machine for a slice of emulated time and handles queued
+    // input, replay, rewind snapshots and frames between slices.
     void run_cpu();
 
-    void paint(SDL_Renderer *render, int widht, int height);
+    // Queue an XT scancode, or the make or break code of an SDL key event.
+    // Returns false if the queue is full.
+    bool key_typed(int scancode);
+    bool key_event(const SDL_KeyboardEvent &event);
+
+    // Speed as a multiple of the 4.77 MHz clock, 0 for unthrottled, and how
+    // closely it was held. Call from the CPU thread or while it is stopped.
+    void            set_speed(double multiple);
+    Throttle::Stats speed_stats();
+
+    // Maps the HostControl device; on_exit runs on the CPU thread when the
+    // guest asks to exit.
+    void enable_host_control(HostControl::Exit on_exit);
+
+    void enable_rewind(int interval_ms, size_t capacity);
+    bool rewind(int snapshots);
+
+    void start_recording(const std::string &path);
+    void stop_recording();
+    void start_replay(const std::string &path);
+
+    void use_software_renderer(bool enable);
+    void set_font(const Font &font);
+    int  screen_width();
+    int  screen_height();
+    void capture_screen(const std::string &path);
+
+    // paint() draws the latest frame if there is one. It returns how many
+    // milliseconds to wait before calling it again, or -1 to wait for the
+    // next frame_event().
+    void     set_max_fps(int fps);
+    uint32_t frame_event();
+    void     repaint();
+    int      paint(SDL_Renderer *render, int widht, int height);
+
+  private:
+    void deliverKey(int scancode);
+    void publishFrame();
+    void paintSoftware(SDL_Renderer *renderer, bool fresh);
+    void present(SDL_Renderer *renderer);
+    void buildAtlas(SDL_Renderer *renderer);
+    void drawCell(SDL_Renderer *renderer, const uint8_t *cells, int cell, int cursor_shape);
 };
@@ -0,0 +1,50 @@
+#include "PagePool.h"
+#include "Arena.h"
+#include <cstring>
+
+alignas(PagePool::PAGE_SIZE) static const uint8_t ZERO_PAGE[PagePool::PAGE_SIZE] = {};
+
+PagePool &PagePool::shared()
+{
+    static PagePool pool;
+    return pool;
+}
+const uint8_t *PagePool::zero_page()
+{
+    return ZERO_PAGE;
+}
+uint8_t *PagePool::allocate()
+{
+    uint8_t *page;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (m_free.empty()) {
+            auto slab = (uint8_t *)Arena::shared().allocate(SLAB_PAGES * PAGE_SIZE, PAGE_SIZE);
+            m_slabs.push_back(slab);
+            for (size_t i = SLAB_PAGES; i > 0; --i) {
+                m_free.push_back(slab + (i - 1) * PAGE_SIZE);
+            }
+        }
+        page = m_free.back();
+        m_free.pop_back();
+        ++m_in_use;
+    }
+    memset(page, 0, PAGE_SIZE);
+    return page;
+}
+void PagePool::release(uint8_t *page)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_free.push_back(page);
+    --m_in_use;
+}
+size_t PagePool::in_use()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_in_use;
+}
+size_t PagePool::capacity()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_slabs.size() * SLAB_PAGES;
+}
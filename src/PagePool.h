@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Process-wide pool of guest RAM pages shared by all Intel8086 instances.
+// Pages are carved from slabs in the shared Arena and recycled through a free
+// list, so machines that never touch most of their address space cost almost
+// nothing.
+class PagePool {
+  public:
+    static const size_t PAGE_SIZE  = 0x1000;
+    static const size_t SLAB_PAGES = 64;
+
+  private:
+    std::mutex             m_lock;
+    std::vector<uint8_t *> m_slabs;
+    std::vector<uint8_t *> m_free;
+    size_t                 m_in_use = 0;
+
+  public:
+    PagePool() = default;
+
+    PagePool(const PagePool &)            = delete;
+    PagePool &operator=(const PagePool &) = delete;
+
+    static PagePool      &shared();
+    static const uint8_t *zero_page();
+
+    uint8_t *allocate();
+    void     release(uint8_t *page);
+
+    size_t in_use();
+    size_t capacity();
+};
@@ -2,6 +2,8 @@
 
 class Peripheral {
   public:
+    virtual ~Peripheral() = default;
+
     virtual bool isConnected(int port)             = 0;
     virtual int  portIn(int w, int port)           = 0;
     virtual void portOut(int w, int port, int val) = 0;
@@ -0,0 +1,190 @@
+#include "Rasterizer.h"
+#include "Motorola6845.h"
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+const uint8_t CGA_PALETTE[16][3] = {{0, 0, 0},     {0, 0, 170},    {0, 170, 0},    {0, 170, 170},
+                                    {170, 0, 0},   {170, 0, 170},  {170, 85, 0},   {170, 170, 170},
+                                    {85, 85, 85},  {85, 85, 255},  {85, 255, 85},  {85, 255, 255},
+                                    {255, 85, 85}, {255, 85, 255}, {255, 255, 85}, {255, 255, 255}};
+
+Rasterizer::Rasterizer(const Font &font) : m_font(font)
+{
+    if (m_font.width != 8) {
+        throw std::invalid_argument("rasterizer needs 8 pixel wide glyphs");
+    }
+    for (int i = 0; i < 16; ++i) {
+        m_palette[i] = 0xff000000u | CGA_PALETTE[i][0] << 16 | CGA_PALETTE[i][1] << 8 | CGA_PALETTE[i][2];
+    }
+    resize(80 * m_font.width, 25 * m_font.height);
+}
+void Rasterizer::resize(int width, int height)
+{
+    if (width != m_width || height != m_height) {
+        m_width  = width;
+        m_height = height;
+        m_pixels.assign(width * height, 0);
+        m_decoded_valid = false;
+    }
+}
+void Rasterizer::draw(const VideoFrame &frame)
+{
+    if ((frame.mode & Motorola6845::MODE_GRAPHICS) != 0) {
+        drawGraphics(frame);
+    } else {
+        drawText(frame);
+    }
+}
+void Rasterizer::drawText(const VideoFrame &frame)
+{
+    const int columns = frame.columns();
+    const int rows    = frame.rows();
+    resize(columns * m_font.width, rows * m_font.height);
+    m_decoded_valid = false;
+
+    const uint8_t *cells  = frame.text(m_scratch);
+    const int      cursor = frame.cursor();
+    for (int cell = 0; cell < columns * rows; ++cell) {
+        drawCell(cells, cell, columns, cell == cursor ? frame.cursor_shape() : -1);
+    }
+}
+void Rasterizer::drawCell(const uint8_t *cells, int cell, int columns, int cursor_shape)
+{
+    const uint8_t *glyph     = m_font.glyphs + cells[2 * cell] * m_font.height;
+    const int      attribute = cells[2 * cell + 1];
+    const uint32_t fg        = m_palette[attribute & 0b1111];
+    const uint32_t bg        = m_palette[attribute >> 4 & 0b111];
+    uint32_t      *out       = &m_pixels[cell / columns * m_font.height * m_width + cell % columns * 8];
+
+    // Cursor scan lines are given for an 8 line cell.
+    int top = 0, bottom = 0;
+    if (cursor_shape >= 0) {
+        const int start = cursor_shape >> 8 & 0x1f;
+        const int end   = (cursor_shape & 0x1f) < 8 ? cursor_shape & 0x1f : 7;
+        if (start <= end) {
+            top    = start * m_font.height / 8;
+            bottom = (end + 1) * m_font.height / 8;
+        }
+    }
+
+    // Each glyph row expands to 8 pixels: bg where the bit is clear, fg where
+    // it is set, i.e. bg ^ (mask & (fg ^ bg)).
+#if defined(__SSE2__) || defined(_M_X64)
+    const __m128i left  = _mm_set_epi32(0x10, 0x20, 0x40, 0x80);
+    const __m128i right = _mm_set_epi32(0x01, 0x02, 0x04, 0x08);
+    const __m128i back  = _mm_set1_epi32((int)bg);
+    const __m128i diff  = _mm_set1_epi32((int)(fg ^ bg));
+#endif
+    for (int y = 0; y < m_font.height; ++y, out += m_width) {
+        const int bits = y >= top && y < bottom ? 0xff : glyph[y];
+#if defined(__SSE2__) || defined(_M_X64)
+        const __m128i row   = _mm_set1_epi32(bits);
+        __m128i       mask0 = _mm_cmpeq_epi32(_mm_and_si128(row, left), left);
+        __m128i       mask1 = _mm_cmpeq_epi32(_mm_and_si128(row, right), right);
+        _mm_storeu_si128((__m128i *)out, _mm_xor_si128(back, _mm_and_si128(mask0, diff)));
+        _mm_storeu_si128((__m128i *)(out + 4), _mm_xor_si128(back, _mm_and_si128(mask1, diff)));
+#else
+        for (int x = 0; x < 8; ++x) {
+            out[x] = bits >> (7 - x) & 1 ? fg : bg;
+        }
+#endif
+    }
+}
+void Rasterizer::drawGraphics(const VideoFrame &frame)
+{
+    resize(GRAPHICS_W, GRAPHICS_H);
+    const int key = (frame.mode & (Motorola6845::MODE_HIRES | Motorola6845::MODE_MONO)) << 8 | frame.color;
+    if (key != m_lut_key) {
+        buildLut(frame.mode, frame.color);
+        m_lut_key       = key;
+        m_decoded_valid = false;
+    }
+
+    for (int y = 0; y < GRAPHICS_H; ++y) {
+        const int      offset = (y & 1) * BANK_SIZE + (y >> 1) * LINE_BYTES;
+        const uint8_t *line   = frame.vram + offset;
+        if (m_decoded_valid && memcmp(line, m_decoded + offset, LINE_BYTES) == 0) {
+            continue;
+        }
+        memcpy(m_decoded + offset, line, LINE_BYTES);
+
+        // One table lookup per byte yields its 8 pixels as two vectors.
+        uint32_t *out = &m_pixels[y * GRAPHICS_W];
+        for (int x = 0; x < LINE_BYTES; ++x, out += 8) {
+#if defined(__SSE2__) || defined(_M_X64)
+            const __m128i *pixels = (const __m128i *)m_lut[line[x]];
+            _mm_storeu_si128((__m128i *)out, _mm_load_si128(pixels));
+            _mm_storeu_si128((__m128i *)(out + 4), _mm_load_si128(pixels + 1));
+#else
+            memcpy(out, m_lut[line[x]], sizeof(m_lut[0]));
+#endif
+        }
+    }
+    m_decoded_valid = true;
+}
+void Rasterizer::buildLut(int mode, int color)
+{
+    if ((mode & Motorola6845::MODE_HIRES) != 0) {
+        // 640x200: one bit per pixel, black and the color select foreground.
+        for (int b = 0; b < 256; ++b) {
+            for (int x = 0; x < 8; ++x) {
+                m_lut[b][x] = m_palette[b >> (7 - x) & 1 ? color & 0b1111 : 0];
+            }
+        }
+        return;
+    }
+
+    // 320x200: two bits per pixel. Color 0 is the color select background;
+    // 1-3 come from the palette picked by bit 5, or the third palette when
+    // the mode register disables the color burst.
+    static const int PALETTES[3][3] = {{2, 4, 6}, {3, 5, 7}, {3, 4, 7}};
+
+    const int *palette = PALETTES[(mode & Motorola6845::MODE_MONO) != 0 ? 2 : color >> 5 & 1];
+    const int  bright  = (color & 0x10) != 0 ? 8 : 0;
+    uint32_t   colors[4];
+    colors[0] = m_palette[color & 0b1111];
+    for (int i = 0; i < 3; ++i) {
+        colors[i + 1] = m_palette[palette[i] + bright];
+    }
+    for (int b = 0; b < 256; ++b) {
+        for (int x = 0; x < 4; ++x) {
+            m_lut[b][2 * x] = m_lut[b][2 * x + 1] = colors[b >> (6 - 2 * x) & 0b11];
+        }
+    }
+}
+const uint32_t *Rasterizer::pixels()
+{
+    return m_pixels.data();
+}
+int Rasterizer::width()
+{
+    return m_width;
+}
+int Rasterizer::height()
+{
+    return m_height;
+}
+int Rasterizer::pitch()
+{
+    return m_width * sizeof(uint32_t);
+}
+void Rasterizer::save_ppm(const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error(path + ": cannot create image");
+    }
+    fprintf(file, "P6\n%d %d\n255\n", m_width, m_height);
+    std::vector<uint8_t> rgb(m_pixels.size() * 3);
+    for (size_t i = 0; i < m_pixels.size(); ++i) {
+        rgb[3 * i]     = m_pixels[i] >> 16;
+        rgb[3 * i + 1] = m_pixels[i] >> 8;
+        rgb[3 * i + 2] = m_pixels[i];
+    }
+    fwrite(rgb.data(), rgb.size(), 1, file);
+    fclose(file);
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Font.h"
+#include "FrameBuffer.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// CGA palette, RGB per entry.
+extern const uint8_t CGA_PALETTE[16][3];
+
+// Draws a CGA text or graphics screen into a 32-bit ARGB pixel buffer in
+// software. Needs no SDL: the buffer is uploaded to a
+// streaming texture by the frontend, or written to an image file for
+// headless capture.
+class Rasterizer {
+  public:
+    // Both graphics modes are 200 lines of 80 bytes, even lines in the first
+    // bank and odd lines in the second. 320x200 pixels are drawn doubled.
+    static const int GRAPHICS_W = 640;
+    static const int GRAPHICS_H = 200;
+    static const int LINE_BYTES = 80;
+    static const int BANK_SIZE  = 0x2000;
+
+  private:
+    const Font           &m_font;
+    uint32_t              m_palette[16];
+    std::vector<uint32_t> m_pixels;
+    int                   m_width  = 0;
+    int                   m_height = 0;
+
+    // Graphics: the 8 output pixels of every byte value in the current mode,
+    // and the video memory they were last decoded from, so only scan lines
+    // that changed are decoded again.
+    alignas(16) uint32_t m_lut[256][8];
+    int                  m_lut_key = -1;
+    uint8_t              m_decoded[VideoFrame::VRAM_SIZE];
+    bool                 m_decoded_valid = false;
+    uint8_t              m_scratch[VideoFrame::VRAM_SIZE];
+
+  public:
+    explicit Rasterizer(const Font &font);
+
+    // Text is drawn with the CRTC geometry, one glyph per cell; the buffer
+    // size follows. Graphics modes are always 640x200.
+    void draw(const VideoFrame &frame);
+
+    const uint32_t *pixels();
+    int             width();
+    int             height();
+    int             pitch();
+
+    void save_ppm(const std::string &path);
+
+  private:
+    void resize(int width, int height);
+    void drawText(const VideoFrame &frame);
+    void drawGraphics(const VideoFrame &frame);
+    void buildLut(int mode, int color);
+    void drawCell(const uint8_t *cells, int cell, int columns, int cursor_shape);
+};
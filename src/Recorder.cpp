@@ -0,0 +1,207 @@
+#include "Recorder.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+static const char MAGIC[8] = {'I', '8', '6', 'R', 'P', 'L', 0, 2};
+
+static bool isZeroPage(const uint8_t *data)
+{
+    return data[0] == 0 && memcmp(data, data + 1, Intel8086::PAGE_SIZE - 1) == 0;
+}
+Recorder::Recorder(Intel8086 *cpu, const std::string &path) : m_cpu(cpu)
+{
+    m_file = fopen(path.c_str(), "wb");
+    if (m_file == nullptr) {
+        throw std::runtime_error(path + ": cannot create input log");
+    }
+    setvbuf(m_file, nullptr, _IOFBF, 1 << 16);
+
+    Intel8086::State st;
+    memset(&st, 0, sizeof(st));
+    m_cpu->save_state(st);
+    uint32_t size = sizeof(st);
+    fwrite(MAGIC, sizeof(MAGIC), 1, m_file);
+    fwrite(&size, sizeof(size), 1, m_file);
+    fwrite(&st, sizeof(st), 1, m_file);
+
+    for (int page = 0; page < Intel8086::PAGE_COUNT; ++page) {
+        const uint8_t *data = m_cpu->mem_page(page * Intel8086::PAGE_SIZE);
+        if (m_cpu->is_rom_page(page) || isZeroPage(data)) {
+            continue;
+        }
+        uint16_t number = page;
+        fwrite(&number, sizeof(number), 1, m_file);
+        fwrite(data, Intel8086::PAGE_SIZE, 1, m_file);
+    }
+    uint16_t end = 0xffff;
+    fwrite(&end, sizeof(end), 1, m_file);
+    m_last      = m_cpu->get_cycles();
+    m_last_tick = m_cpu->get_ticks();
+}
+Recorder::~Recorder()
+{
+    record(EVENT_END, fingerprint(m_cpu) & 0xffffffff);
+    fclose(m_file);
+}
+void Recorder::record(int type, int value)
+{
+    const long long now  = m_cpu->get_cycles();
+    const long long tick = m_cpu->get_ticks();
+    writeVarint(now - m_last);
+    writeVarint(tick - m_last_tick);
+    fputc(type, m_file);
+    writeVarint((uint32_t)value);
+    m_last      = now;
+    m_last_tick = tick;
+}
+uint64_t Recorder::fingerprint(Intel8086 *cpu)
+{
+    // FNV-1a over the machine state and all RAM.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto     mix  = [&hash](const uint8_t *data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ data[i]) * 0x100000001b3ull;
+        }
+    };
+    Intel8086::State st;
+    memset(&st, 0, sizeof(st));
+    cpu->save_state(st);
+    mix((const uint8_t *)&st, sizeof(st));
+    for (int page = 0; page < Intel8086::PAGE_COUNT; ++page) {
+        if (!cpu->is_rom_page(page)) {
+            mix(cpu->mem_page(page * Intel8086::PAGE_SIZE), Intel8086::PAGE_SIZE);
+        }
+    }
+    return hash;
+}
+void Recorder::writeVarint(uint64_t value)
+{
+    while (value >= 0x80) {
+        fputc((int)(value & 0x7f) | 0x80, m_file);
+        value >>= 7;
+    }
+    fputc((int)value, m_file);
+}
+Replayer::Replayer(Intel8086 *cpu, const std::string &path) : m_cpu(cpu)
+{
+    m_file = fopen(path.c_str(), "rb");
+    if (m_file == nullptr) {
+        throw std::runtime_error(path + ": cannot open input log");
+    }
+    char             magic[sizeof(MAGIC)];
+    uint32_t         size = 0;
+    Intel8086::State st{};
+    if (fread(magic, sizeof(magic), 1, m_file) != 1 || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        fread(&size, sizeof(size), 1, m_file) != 1 || size != sizeof(st) ||
+        fread(&st, sizeof(st), 1, m_file) != 1) {
+        fclose(m_file);
+        throw std::runtime_error(path + ": not an input log from this build");
+    }
+
+    static const uint8_t zero[Intel8086::PAGE_SIZE] = {};
+    for (int page = 0; page < Intel8086::PAGE_COUNT; ++page) {
+        m_cpu->load_page(page, zero);
+    }
+    uint8_t data[Intel8086::PAGE_SIZE];
+    while (true) {
+        uint16_t number;
+        if (fread(&number, sizeof(number), 1, m_file) != 1) {
+            fclose(m_file);
+            throw std::runtime_error(path + ": truncated input log");
+        }
+        if (number == 0xffff) {
+            break;
+        }
+        if (number >= Intel8086::PAGE_COUNT || fread(data, sizeof(data), 1, m_file) != 1) {
+            fclose(m_file);
+            throw std::runtime_error(path + ": truncated input log");
+        }
+        m_cpu->load_page(number, data);
+    }
+    m_cpu->load_state(st);
+    m_next      = m_cpu->get_cycles();
+    m_next_tick = m_cpu->get_ticks();
+    readEvent();
+}
+Replayer::~Replayer()
+{
+    fclose(m_file);
+}
+void Replayer::poll()
+{
+    while (!m_finished) {
+        const long long cycles = m_cpu->get_cycles();
+        const long long ticks  = m_cpu->get_ticks();
+        if (cycles < m_next || (cycles == m_next && ticks < m_next_tick)) {
+            return;
+        }
+        if (cycles != m_next || ticks != m_next_tick) {
+            m_diverged = true;
+        }
+        switch (m_type) {
+            case Recorder::EVENT_KEY:
+                m_cpu->m_ppi->keyTyped((int)m_value);
+                break;
+            case Recorder::EVENT_END:
+                if ((Recorder::fingerprint(m_cpu) & 0xffffffff) != m_value) {
+                    m_diverged = true;
+                }
+                m_finished = true;
+                return;
+        }
+        readEvent();
+    }
+}
+void Replayer::limit(long long &tick_limit, long long &cycle_limit)
+{
+    if (m_finished) {
+        return;
+    }
+    if (m_cpu->get_cycles() < m_next) {
+        cycle_limit = std::min(cycle_limit, m_next);
+        return;
+    }
+    // Halted at the event's instruction count: wait for its tick. A CPU that
+    // runs on instead diverged, which poll() notices after one instruction.
+    tick_limit  = std::min(tick_limit, m_next_tick);
+    cycle_limit = std::min(cycle_limit, m_next + 1);
+}
+bool Replayer::finished()
+{
+    return m_finished;
+}
+bool Replayer::diverged()
+{
+    return m_diverged;
+}
+void Replayer::readEvent()
+{
+    uint64_t delta, delta_ticks;
+    int      type;
+    if (!readVarint(delta) || !readVarint(delta_ticks) || (type = fgetc(m_file)) == EOF || !readVarint(m_value)) {
+        // Log cut short, e.g. the recording process died: nothing left to check.
+        m_finished = true;
+        return;
+    }
+    m_type = type;
+    m_next += (long long)delta;
+    m_next_tick += (long long)delta_ticks;
+}
+bool Replayer::readVarint(uint64_t &value)
+{
+    value     = 0;
+    int shift = 0;
+    while (true) {
+        int c = fgetc(m_file);
+        if (c == EOF || shift > 63) {
+            return false;
+        }
+        value |= (uint64_t)(c & 0x7f) << shift;
+        if ((c & 0x80) == 0) {
+            return true;
+        }
+        shift += 7;
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "Intel8086.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Input log for deterministic record and replay.
+// A log starts with a snapshot of the machine (state and RAM pages), followed
+// by a stream of events. Each event is stamped with the instruction count and
+// the PIT tick at which it was delivered, so replaying from the snapshot
+// reproduces the run exactly regardless of host speed; the tick tells apart
+// the moments of a halt, when time passes but no instructions run. Event
+// times (as differences to the previous event) and values are LEB128 varints;
+// the type is one byte.
+class Recorder {
+  public:
+    enum Event
+    {
+        EVENT_END = 0,    // value: low 32 bits of the final fingerprint
+        EVENT_KEY = 1,    // value: scancode delivered to Intel8255::keyTyped
+    };
+
+  private:
+    Intel8086 *m_cpu;
+    FILE      *m_file;
+    long long  m_last      = 0;
+    long long  m_last_tick = 0;
+
+  public:
+    Recorder(Intel8086 *cpu, const std::string &path);
+    ~Recorder();
+
+    Recorder(const Recorder &)            = delete;
+    Recorder &operator=(const Recorder &) = delete;
+
+    void record(int type, int value);
+
+    static uint64_t fingerprint(Intel8086 *cpu);
+
+  private:
+    void writeVarint(uint64_t value);
+};
+
+// Plays back a log written by Recorder into a machine with the same ROMs.
+// Call poll() before every instruction, or run up to the limits set by
+// limit() and poll there; it delivers the events that are due.
+class Replayer {
+  private:
+    Intel8086 *m_cpu;
+    FILE      *m_file;
+    long long  m_next      = 0;
+    long long  m_next_tick = 0;
+    int        m_type      = Recorder::EVENT_END;
+    uint64_t   m_value     = 0;
+    bool       m_finished  = false;
+    bool       m_diverged  = false;
+
+  public:
+    Replayer(Intel8086 *cpu, const std::string &path);
+    ~Replayer();
+
+    Replayer(const Replayer &)            = delete;
+    Replayer &operator=(const Replayer &) = delete;
+
+    void poll();
+
+    // Lowers the limits of a run_until() call so it stops at the next
+    // event: at its instruction count, or at its tick if the CPU is halted
+    // there.
+    void limit(long long &tick_limit, long long &cycle_limit);
+    bool finished();
+    bool diverged();
+
+  private:
+    void readEvent();
+    bool readVarint(uint64_t &value);
+};
@@ -0,0 +1,233 @@
+#include "Rewind.h"
+#include <cstring>
+#include <stdexcept>
+
+static const int      PAGE_SIZE  = Intel8086::PAGE_SIZE;
+static const int      PAGE_COUNT = Intel8086::PAGE_COUNT;
+static const uint16_t RAW        = 0xffff;
+
+// Per page: page number and encoded length, followed by the encoded delta.
+static const size_t PAGE_HEADER = 4;
+static const size_t PAGE_BOUND  = PAGE_HEADER + PAGE_SIZE;
+
+static size_t align8(size_t n)
+{
+    return (n + 7) & ~(size_t)7;
+}
+Rewind::Rewind(Intel8086 *cpu, int interval_ms, size_t capacity)
+    : m_cpu(cpu), m_arena(Arena::shared().huge_pages()), m_capacity(align8(capacity))
+{
+    if (m_capacity < 2 * (sizeof(Header) + PAGE_COUNT * PAGE_BOUND)) {
+        throw std::invalid_argument("rewind buffer too small to hold a full snapshot");
+    }
+    m_interval = (long long)interval_ms * Intel8086::PIT_HZ / 1000;
+    if (m_interval <= 0) {
+        m_interval = 1;
+    }
+    m_shadow = (uint8_t *)m_arena.allocate(PAGE_COUNT * PAGE_SIZE, PAGE_SIZE);
+    m_ring   = (uint8_t *)m_arena.allocate(m_capacity, 64);
+    m_slots  = (Slot *)m_arena.allocate(MAX_SNAPSHOTS * sizeof(Slot), 64);
+
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        m_versions[page] = m_cpu->page_version(page);
+        memcpy(m_shadow + page * PAGE_SIZE, m_cpu->mem_page(page * PAGE_SIZE), PAGE_SIZE);
+    }
+    take();
+}
+void Rewind::poll()
+{
+    if (m_cpu->get_ticks() >= m_next) {
+        take();
+    }
+}
+void Rewind::take()
+{
+    int dirty = 0;
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        if (!m_cpu->is_rom_page(page) && m_cpu->page_version(page) != m_versions[page]) {
+            ++dirty;
+        }
+    }
+
+    const size_t offset = reserve(align8(sizeof(Header) + dirty * PAGE_BOUND));
+    uint8_t     *out    = m_ring + offset + sizeof(Header);
+    Header      *header = (Header *)(m_ring + offset);
+    m_cpu->save_state(header->state);
+    header->pages = dirty;
+
+    for (int page = 0; page < PAGE_COUNT && dirty > 0; ++page) {
+        if (m_cpu->is_rom_page(page)) {
+            continue;
+        }
+        // page_version() has already write protected the page above.
+        const uint32_t version = m_cpu->page_version(page);
+        if (version == m_versions[page]) {
+            continue;
+        }
+        m_versions[page] = version;
+
+        uint16_t number = page;
+        uint16_t len    = (uint16_t)encode(m_cpu->mem_page(page * PAGE_SIZE), m_shadow + page * PAGE_SIZE,
+                                           out + PAGE_HEADER);
+        memcpy(out, &number, 2);
+        memcpy(out + 2, &len, 2);
+        out += PAGE_HEADER + (len == RAW ? PAGE_SIZE : len);
+        --dirty;
+    }
+    header->size = align8(out - (uint8_t *)header);
+
+    Slot &newest  = slot(m_count++);
+    newest.offset = offset;
+    newest.size   = header->size;
+    m_next        = m_cpu->get_ticks() + m_interval;
+}
+bool Rewind::rewind(int count)
+{
+    if (count < 1) {
+        return false;
+    }
+    revertToNewest();
+
+    // Each snapshot's deltas lead from its predecessor to it; undo them one
+    // by one. The oldest snapshot's predecessor is gone, so it is the limit.
+    while (--count > 0 && m_count > 1) {
+        Slot          &newest = slot(m_count - 1);
+        const Header  *header = (const Header *)(m_ring + newest.offset);
+        const uint8_t *in     = (const uint8_t *)(header + 1);
+        for (uint32_t i = 0; i < header->pages; ++i) {
+            uint16_t page, len;
+            memcpy(&page, in, 2);
+            memcpy(&len, in + 2, 2);
+            decode(in + PAGE_HEADER, len, m_shadow + page * PAGE_SIZE);
+            m_cpu->load_page(page, m_shadow + page * PAGE_SIZE);
+            m_versions[page] = m_cpu->page_version(page);
+            in += PAGE_HEADER + (len == RAW ? PAGE_SIZE : len);
+        }
+        --m_count;
+    }
+
+    const Header *header = (const Header *)(m_ring + slot(m_count - 1).offset);
+    m_cpu->load_state(header->state);
+    m_next = m_cpu->get_ticks() + m_interval;
+    return true;
+}
+int Rewind::snapshots()
+{
+    return m_count;
+}
+size_t Rewind::used_bytes()
+{
+    size_t used = 0;
+    for (int i = 0; i < m_count; ++i) {
+        used += slot(i).size;
+    }
+    return used;
+}
+Rewind::Slot &Rewind::slot(int index)
+{
+    return m_slots[(m_first + index) % MAX_SNAPSHOTS];
+}
+size_t Rewind::reserve(size_t bound)
+{
+    size_t offset = 0;
+    if (m_count > 0) {
+        const Slot &newest = slot(m_count - 1);
+        offset             = newest.offset + newest.size;
+        if (offset + bound > m_capacity) {
+            offset = 0;
+        }
+    }
+    // Drop the oldest snapshots until the new one fits.
+    while (m_count > 0) {
+        const Slot &oldest  = slot(0);
+        bool        overlap = oldest.offset < offset + bound && offset < oldest.offset + oldest.size;
+        if (!overlap && m_count < MAX_SNAPSHOTS) {
+            break;
+        }
+        m_first = (m_first + 1) % MAX_SNAPSHOTS;
+        --m_count;
+    }
+    return offset;
+}
+size_t Rewind::encode(const uint8_t *cur, uint8_t *shadow, uint8_t *out)
+{
+    // Runs of (zero bytes to skip, literal count, literal XOR bytes). Zero
+    // gaps shorter than a run header are folded into the literal.
+    size_t n = 0;
+    int    i = 0;
+    while (i < PAGE_SIZE) {
+        int start = i;
+        while (i < PAGE_SIZE && cur[i] == shadow[i]) {
+            ++i;
+        }
+        if (i == PAGE_SIZE) {
+            break;
+        }
+        uint16_t skip = i - start;
+        int      lit  = i;
+        while (i < PAGE_SIZE) {
+            if (cur[i] != shadow[i]) {
+                ++i;
+                continue;
+            }
+            int zeros = 0;
+            while (i + zeros < PAGE_SIZE && zeros < 4 && cur[i + zeros] == shadow[i + zeros]) {
+                ++zeros;
+            }
+            if (zeros == 4 || i + zeros == PAGE_SIZE) {
+                break;
+            }
+            i += zeros;
+        }
+        uint16_t count = i - lit;
+        if (n + 4 + count >= PAGE_SIZE) {
+            n = RAW;
+            break;
+        }
+        memcpy(out + n, &skip, 2);
+        memcpy(out + n + 2, &count, 2);
+        for (int j = 0; j < count; ++j) {
+            out[n + 4 + j] = cur[lit + j] ^ shadow[lit + j];
+        }
+        n += 4 + count;
+    }
+    if (n == RAW) {
+        for (int j = 0; j < PAGE_SIZE; ++j) {
+            out[j] = cur[j] ^ shadow[j];
+        }
+    }
+    memcpy(shadow, cur, PAGE_SIZE);
+    return n;
+}
+void Rewind::decode(const uint8_t *in, size_t len, uint8_t *shadow)
+{
+    if (len == RAW) {
+        for (int j = 0; j < PAGE_SIZE; ++j) {
+            shadow[j] ^= in[j];
+        }
+        return;
+    }
+    size_t n = 0;
+    int    i = 0;
+    while (n < len) {
+        uint16_t skip, count;
+        memcpy(&skip, in + n, 2);
+        memcpy(&count, in + n + 2, 2);
+        i += skip;
+        for (int j = 0; j < count; ++j) {
+            shadow[i + j] ^= in[n + 4 + j];
+        }
+        i += count;
+        n += 4 + count;
+    }
+}
+void Rewind::revertToNewest()
+{
+    // Undo stores made since the newest snapshot from the shadow copy.
+    for (int page = 0; page < PAGE_COUNT; ++page) {
+        if (!m_cpu->is_rom_page(page) && m_cpu->page_version(page) != m_versions[page]) {
+            m_cpu->load_page(page, m_shadow + page * PAGE_SIZE);
+            m_versions[page] = m_cpu->page_version(page);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Arena.h"
+#include "Intel8086.h"
+
+// Rewind history for one machine.
+// Every interval of virtual time poll() records a snapshot holding the CPU and
+// device state plus the pages written since the previous snapshot, each stored
+// as an XOR delta against its previous contents and run-length encoded.
+// Snapshots live in a bounded ring; the oldest ones are dropped when it fills.
+// All storage is taken from a private arena up front, so recording never
+// allocates.
+class Rewind {
+  public:
+    static const int MAX_SNAPSHOTS = 4096;
+
+  private:
+    struct Header
+    {
+        Intel8086::State state;
+        uint32_t         size;
+        uint32_t         pages;
+    };
+    struct Slot
+    {
+        size_t offset;
+        size_t size;
+    };
+
+    Intel8086 *m_cpu;
+    Arena      m_arena;
+    long long  m_interval;
+    long long  m_next;
+
+    // Page contents as of the newest snapshot, and the version they had.
+    uint8_t *m_shadow;
+    uint32_t m_versions[Intel8086::PAGE_COUNT]{};
+
+    uint8_t *m_ring;
+    size_t   m_capacity;
+    Slot    *m_slots;
+    int      m_first = 0;
+    int      m_count = 0;
+
+  public:
+    Rewind(Intel8086 *cpu, int interval_ms, size_t capacity);
+
+    Rewind(const Rewind &)            = delete;
+    Rewind &operator=(const Rewind &) = delete;
+
+    void poll();
+    void take();
+    bool rewind(int count);
+
+    int    snapshots();
+    size_t used_bytes();
+
+  private:
+    Slot   &slot(int index);
+    size_t  reserve(size_t bound);
+    size_t  encode(const uint8_t *cur, uint8_t *shadow, uint8_t *out);
+    void    decode(const uint8_t *in, size_t len, uint8_t *shadow);
+    void    revertToNewest();
+};
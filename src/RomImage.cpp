@@ -0,0 +1,124 @@
+#include "RomImage.h"
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static std::string error_message(const std::string &path, const char *what)
+{
+    return path + ": " + what;
+}
+RomImage::RomImage(const std::string &path) : m_path(path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error(error_message(path, "cannot open ROM image"));
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error(error_message(path, "empty or unreadable ROM image"));
+    }
+    m_size   = (size_t)size.QuadPart;
+    m_length = (m_size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping != NULL) {
+        m_data = (const uint8_t *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+    }
+    if (m_data != nullptr) {
+        m_mapped = true;
+    } else {
+        auto  buffer = new uint8_t[m_length]();
+        DWORD read   = 0;
+        BOOL  ok     = ReadFile(file, buffer, (DWORD)m_size, &read, NULL);
+        if (!ok || read != m_size) {
+            delete[] buffer;
+            CloseHandle(file);
+            throw std::runtime_error(error_message(path, "cannot read ROM image"));
+        }
+        m_data = buffer;
+    }
+    CloseHandle(file);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(error_message(path, strerror(errno)));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error(error_message(path, "empty or unreadable ROM image"));
+    }
+    m_size   = (size_t)st.st_size;
+    m_length = (m_size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+
+    // A private read-only mapping never diverges from the file, so every
+    // mapping of it is backed by the same page cache pages.
+    void *addr = mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+        m_data   = (const uint8_t *)addr;
+        m_mapped = true;
+    } else {
+        auto    buffer = new uint8_t[m_length]();
+        ssize_t n      = pread(fd, buffer, m_size, 0);
+        if (n != (ssize_t)m_size) {
+            delete[] buffer;
+            ::close(fd);
+            throw std::runtime_error(error_message(path, "cannot read ROM image"));
+        }
+        m_data = buffer;
+    }
+    ::close(fd);
+#endif
+}
+RomImage::~RomImage()
+{
+    if (m_mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap((void *)m_data, m_length);
+#endif
+    } else {
+        delete[] m_data;
+    }
+}
+std::shared_ptr<RomImage> RomImage::open(const std::string &path)
+{
+    static std::mutex                                     lock;
+    static std::map<std::string, std::weak_ptr<RomImage>> images;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto                        image = images[path].lock();
+    if (!image) {
+        image        = std::make_shared<RomImage>(path);
+        images[path] = image;
+    }
+    return image;
+}
+const uint8_t *RomImage::data() const
+{
+    return m_data;
+}
+size_t RomImage::size() const
+{
+    return m_size;
+}
+const std::string &RomImage::path() const
+{
+    return m_path;
+}
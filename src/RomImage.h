@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Read-only ROM file mapped into the host address space.
+// Images are shared by path: every machine in the process that loads the same
+// file gets the same mapping, and the OS page cache shares it across processes.
+// data() is readable up to size() rounded up to PAGE_SIZE, zero padded.
+class RomImage {
+  public:
+    static const size_t PAGE_SIZE = 0x1000;
+
+  private:
+    std::string    m_path;
+    const uint8_t *m_data   = nullptr;
+    size_t         m_size   = 0;
+    size_t         m_length = 0;
+    bool           m_mapped = false;
+
+  public:
+    RomImage(const std::string &path);
+    ~RomImage();
+
+    RomImage(const RomImage &)            = delete;
+    RomImage &operator=(const RomImage &) = delete;
+
+    static std::shared_ptr<RomImage> open(const std::string &path);
+
+    const uint8_t     *data() const;
+    size_t             size() const;
+    const std::string &path() const;
+};
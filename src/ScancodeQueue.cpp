@@ -0,0 +1,26 @@
+#include "ScancodeQueue.h"
+
+bool ScancodeQueue::push(int scancode)
+{
+    const uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == CAPACITY) {
+        return false;
+    }
+    m_codes[tail % CAPACITY] = scancode & 0xff;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+bool ScancodeQueue::pop(int &scancode)
+{
+    const uint32_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    scancode = m_codes[head % CAPACITY];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+int ScancodeQueue::free_space()
+{
+    return CAPACITY - (m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_acquire));
+}
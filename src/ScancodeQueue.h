@@ -0,0 +1,20 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Bounded lock-free queue of scancodes from the UI thread to the CPU thread.
+// One producer and one consumer; push() fails instead of overwriting when
+// the queue is full.
+class ScancodeQueue {
+  private:
+    static const uint32_t CAPACITY = 256;
+
+    uint8_t               m_codes[CAPACITY]{};
+    std::atomic<uint32_t> m_head{0};    // next to pop, advanced by the consumer
+    std::atomic<uint32_t> m_tail{0};    // next to push, advanced by the producer
+
+  public:
+    bool push(int scancode);
+    bool pop(int &scancode);
+    int  free_space();
+};
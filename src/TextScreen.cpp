@@ -0,0 +1,256 @@
+#include "TextScreen.h"
+#include "Intel8086.h"
+#include <cstring>
+#include <stdexcept>
+
+// CP437 as displayed: 00 is blank and 01-1f and 7f are the graphic symbols
+// the character generator shows for them.
+const uint16_t CP437_UNICODE[256] = {
+    0x0020, 0x263a, 0x263b, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25d8, 0x25cb, 0x25d9, 0x2642, 0x2640, 0x266a,
+    0x266b, 0x263c, 0x25ba, 0x25c4, 0x2195, 0x203c, 0x00b6, 0x00a7, 0x25ac, 0x21a8, 0x2191, 0x2193, 0x2192, 0x2190,
+    0x221f, 0x2194, 0x25b2, 0x25bc, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
+    0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053,
+    0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d,
+    0x007e, 0x2302, 0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x00e0, 0x00e5, 0x00e7, 0x00ea, 0x00eb, 0x00e8, 0x00ef,
+    0x00ee, 0x00ec, 0x00c4, 0x00c5, 0x00c9, 0x00e6, 0x00c6, 0x00f4, 0x00f6, 0x00f2, 0x00fb, 0x00f9, 0x00ff, 0x00d6,
+    0x00dc, 0x00a2, 0x00a3, 0x00a5, 0x20a7, 0x0192, 0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x00f1, 0x00d1, 0x00aa, 0x00ba,
+    0x00bf, 0x2310, 0x00ac, 0x00bd, 0x00bc, 0x00a1, 0x00ab, 0x00bb, 0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561,
+    0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255d, 0x255c, 0x255b, 0x2510, 0x2514, 0x2534, 0x252c, 0x251c,
+    0x2500, 0x253c, 0x255e, 0x255f, 0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x2567, 0x2568, 0x2564,
+    0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256b, 0x256a, 0x2518, 0x250c, 0x2588, 0x2584, 0x258c, 0x2590, 0x2580,
+    0x03b1, 0x00df, 0x0393, 0x03c0, 0x03a3, 0x03c3, 0x00b5, 0x03c4, 0x03a6, 0x0398, 0x03a9, 0x03b4, 0x221e, 0x03c6,
+    0x03b5, 0x2229, 0x2261, 0x00b1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00f7, 0x2248, 0x00b0, 0x2219, 0x00b7, 0x221a,
+    0x207f, 0x00b2, 0x25a0, 0x0020};
+
+TextScreen::TextScreen(Intel8086 *cpu) : m_cpu(cpu)
+{
+    for (int c = 0; c < 256; ++c) {
+        const int code = CP437_UNICODE[c];
+        uint8_t  *out  = m_utf8[c];
+        if (code < 0x80) {
+            out[0] = 1;
+            out[1] = code;
+        } else if (code < 0x800) {
+            out[0] = 2;
+            out[1] = 0xc0 | code >> 6;
+            out[2] = 0x80 | (code & 0x3f);
+        } else {
+            out[0] = 3;
+            out[1] = 0xe0 | code >> 12;
+            out[2] = 0x80 | (code >> 6 & 0x3f);
+            out[3] = 0x80 | (code & 0x3f);
+        }
+        // 00, 20 and ff are all blank.
+        m_fold[c] = c;
+        for (int d = 0; d < c; ++d) {
+            if (CP437_UNICODE[d] == code) {
+                m_fold[c] = d;
+                break;
+            }
+        }
+    }
+}
+uint64_t TextScreen::changes()
+{
+    refresh();
+    return m_changes;
+}
+const std::string &TextScreen::text()
+{
+    refresh();
+    if (!m_valid) {
+        rebuild();
+    }
+    return m_text;
+}
+const std::vector<TextScreen::Span> &TextScreen::spans()
+{
+    text();
+    return m_spans;
+}
+int TextScreen::columns()
+{
+    refresh();
+    return VideoFrame::columns(m_crtc);
+}
+int TextScreen::rows()
+{
+    refresh();
+    return VideoFrame::rows(m_crtc);
+}
+int TextScreen::cursor()
+{
+    refresh();
+    return VideoFrame::cursor(m_crtc);
+}
+void TextScreen::refresh()
+{
+    bool changed = false;
+    for (int i = 0; i < VideoFrame::VRAM_PAGES; ++i) {
+        const uint32_t version = m_cpu->page_version((VideoFrame::VRAM_BASE >> Intel8086::PAGE_SHIFT) + i);
+        if (version != m_versions[i]) {
+            m_versions[i] = version;
+            changed       = true;
+        }
+    }
+    for (int i = 0; i < 0x10; ++i) {
+        const int value = m_cpu->m_crtc->getRegister(i);
+        if (value != m_crtc[i]) {
+            m_crtc[i] = value;
+            changed   = true;
+        }
+    }
+    if (changed) {
+        ++m_changes;
+        m_valid = false;
+    }
+}
+void TextScreen::rebuild()
+{
+    const int columns = VideoFrame::columns(m_crtc);
+    const int rows    = VideoFrame::rows(m_crtc);
+    const int start   = VideoFrame::start(m_crtc);
+
+    m_text.clear();
+    m_spans.clear();
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            const int      offset = (start + row * columns + column) * 2 % VideoFrame::VRAM_SIZE;
+            const uint8_t *page   = m_cpu->mem_page(VideoFrame::VRAM_BASE + offset);
+            const uint8_t *cell   = page + (offset & (Intel8086::PAGE_SIZE - 1));
+            const uint8_t *utf8   = m_utf8[cell[0]];
+            if (m_spans.empty() || m_spans.back().attribute != cell[1]) {
+                m_spans.push_back({m_text.size(), 0, cell[1]});
+            }
+            m_text.append((const char *)utf8 + 1, utf8[0]);
+            m_spans.back().length = m_text.size() - m_spans.back().offset;
+        }
+        m_text += '\n';
+    }
+    m_valid = true;
+}
+bool TextScreen::wait_for_text(const std::string &text, const Region &region, int timeout_ms)
+{
+    Pattern pattern;
+    compile(text, pattern);
+
+    const long long deadline = m_cpu->get_ticks() + (long long)timeout_ms * Intel8086::PIT_HZ / 1000;
+    int             crtc[0x10];
+    uint64_t        hits  = m_cpu->watch_hits();
+    bool            dirty = true;
+    bool            found = false;
+    memset(crtc, 0xff, sizeof(crtc));
+    while (true) {
+        // Follow the geometry and start address; anything else the CRTC
+        // does, such as moving the cursor, leaves the text alone.
+        bool moved = false;
+        for (int i : {0x1, 0x6, 0xc, 0xd}) {
+            const int value = m_cpu->m_crtc->getRegister(i);
+            if (value != crtc[i]) {
+                crtc[i] = value;
+                moved   = true;
+            }
+        }
+        if (moved) {
+            const int columns = VideoFrame::columns(crtc);
+            const int first   = VideoFrame::start(crtc) + region.row * columns + region.column;
+            const int last    = first + (region.rows > 0 ? region.rows : VideoFrame::rows(crtc)) * columns;
+            if (last * 2 <= VideoFrame::VRAM_SIZE) {
+                m_cpu->watch_writes(VideoFrame::VRAM_BASE + first * 2, VideoFrame::VRAM_BASE + last * 2);
+            } else {
+                m_cpu->watch_writes(VideoFrame::VRAM_BASE, VideoFrame::VRAM_BASE + VideoFrame::VRAM_SIZE);
+            }
+            dirty = true;
+        }
+        if (m_cpu->watch_hits() != hits) {
+            hits  = m_cpu->watch_hits();
+            dirty = true;
+        }
+        if (dirty && search(pattern, region, crtc)) {
+            found = true;
+            break;
+        }
+        dirty = false;
+        if (m_cpu->get_ticks() >= deadline || !step(deadline)) {
+            break;
+        }
+    }
+    m_cpu->watch_writes(0, 0);
+    return found;
+}
+bool TextScreen::step(long long deadline)
+{
+    // A halted CPU skips ahead to its next interrupt, or to the deadline;
+    // one halted with interrupts disabled has nothing left to do.
+    const long long ticks  = m_cpu->get_ticks();
+    const long long cycles = m_cpu->get_cycles();
+    m_cpu->run_until(deadline, cycles + WAIT_SLICE);
+    return m_cpu->get_ticks() != ticks || m_cpu->get_cycles() != cycles;
+}
+void TextScreen::compile(const std::string &text, Pattern &pattern)
+{
+    // UTF-8 to CP437, folding look-alikes the way cells are folded.
+    size_t i = 0;
+    while (i < text.size()) {
+        const uint8_t lead   = text[i];
+        const int     length = lead < 0x80 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+        int           code   = length == 1 ? lead : lead & (0x7f >> length);
+        for (int k = 1; k < length && i + k < text.size(); ++k) {
+            code = code << 6 | (text[i + k] & 0x3f);
+        }
+        i += length;
+
+        int c = 0;
+        while (c < 256 && CP437_UNICODE[c] != code) {
+            ++c;
+        }
+        if (c == 256) {
+            throw std::runtime_error("wait_for_text: pattern has characters outside CP437");
+        }
+        pattern.bytes.push_back(m_fold[c]);
+    }
+
+    pattern.fail.assign(pattern.bytes.size(), 0);
+    int k = 0;
+    for (size_t j = 1; j < pattern.bytes.size(); ++j) {
+        while (k > 0 && pattern.bytes[j] != pattern.bytes[k]) {
+            k = pattern.fail[k - 1];
+        }
+        if (pattern.bytes[j] == pattern.bytes[k]) {
+            ++k;
+        }
+        pattern.fail[j] = k;
+    }
+}
+bool TextScreen::search(const Pattern &pattern, const Region &region, const int *crtc)
+{
+    const int size    = (int)pattern.bytes.size();
+    const int columns = VideoFrame::columns(crtc);
+    const int rows    = VideoFrame::rows(crtc);
+    const int start   = VideoFrame::start(crtc);
+    const int bottom  = region.rows > 0 && region.row + region.rows < rows ? region.row + region.rows : rows;
+    const int right   = region.columns > 0 && region.column + region.columns < columns ? region.column + region.columns
+                                                                                        : columns;
+    if (size == 0) {
+        return true;
+    }
+    for (int row = region.row; row < bottom; ++row) {
+        int matched = 0;
+        for (int column = region.column; column < right; ++column) {
+            const int      offset = (start + row * columns + column) * 2 % VideoFrame::VRAM_SIZE;
+            const uint8_t *page   = m_cpu->mem_page(VideoFrame::VRAM_BASE + offset);
+            const uint8_t  c      = m_fold[page[offset & (Intel8086::PAGE_SIZE - 1)]];
+            while (matched > 0 && c != pattern.bytes[matched]) {
+                matched = pattern.fail[matched - 1];
+            }
+            if (c == pattern.bytes[matched] && ++matched == size) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "FrameBuffer.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Intel8086;
+
+// Unicode code point of each CP437 character.
+extern const uint16_t CP437_UNICODE[256];
+
+// The text screen of a machine as UTF-8, for headless runs. Cells are read
+// straight from guest memory with the CRTC start address and geometry, one
+// line per row. The text is rebuilt only when text memory or the CRTC
+// registers changed since the last call.
+class TextScreen {
+  public:
+    // A run of cells with the same attribute, in bytes of text(). A run
+    // continues across line ends.
+    struct Span
+    {
+        size_t offset;
+        size_t length;
+        int    attribute;
+    };
+
+    // Cells to search, relative to the top left of the screen. A zero size
+    // extends the region to the edge of the screen.
+    struct Region
+    {
+        int row;
+        int column;
+        int rows;
+        int columns;
+    };
+
+  private:
+    // Instructions run between two looks at the watch counter.
+    static const int WAIT_SLICE = 256;
+
+    // A search pattern in CP437 with its KMP failure table.
+    struct Pattern
+    {
+        std::vector<uint8_t> bytes;
+        std::vector<int>     fail;
+    };
+
+    Intel8086        *m_cpu;
+    uint32_t          m_versions[VideoFrame::VRAM_PAGES]{};
+    int               m_crtc[0x10]{};
+    uint64_t          m_changes = 0;
+    bool              m_valid   = false;
+    std::string       m_text;
+    std::vector<Span> m_spans;
+    uint8_t           m_utf8[256][4];    // length, then up to 3 bytes
+    uint8_t           m_fold[256];       // first character that looks the same
+
+  public:
+    explicit TextScreen(Intel8086 *cpu);
+
+    // Counts the changes seen so far; callers compare it with an earlier
+    // value to skip screens they have already looked at.
+    uint64_t changes();
+
+    const std::string       &text();
+    const std::vector<Span> &spans();
+
+    int columns();
+    int rows();
+
+    // Cell the cursor is on, row * columns() + column; -1 if off screen.
+    int cursor();
+
+    // Runs the machine until the UTF-8 pattern shows up within one row of
+    // the region, or until timeout_ms of emulated time has passed. The
+    // region is searched again only after stores to the text memory behind
+    // it or a change of the CRTC geometry. Returns whether it was found.
+    bool wait_for_text(const std::string &pattern, const Region &region = Region{}, int timeout_ms = 10000);
+
+  private:
+    bool step(long long deadline);
+    void refresh();
+    void rebuild();
+    void compile(const std::string &text, Pattern &pattern);
+    bool search(const Pattern &pattern, const Region &region, const int *crtc);
+};
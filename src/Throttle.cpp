@@ -0,0 +1,54 @@
+#include "Throttle.h"
+#include "Intel8086.h"
+#include <thread>
+
+void Throttle::set_speed(double multiple)
+{
+    m_speed   = multiple > 0 ? multiple : 0;
+    m_started = false;
+}
+double Throttle::speed()
+{
+    return m_speed;
+}
+void Throttle::pace(long long ticks)
+{
+    const Clock::time_point now = Clock::now();
+    if (!m_counting) {
+        m_start_host  = now;
+        m_start_ticks = ticks;
+        m_counting    = true;
+    }
+    if (!m_started) {
+        m_base_host  = now;
+        m_base_ticks = ticks;
+        m_started    = true;
+        return;
+    }
+    m_stats.guest_seconds = (double)(ticks - m_start_ticks) / Intel8086::PIT_HZ;
+    m_stats.host_seconds  = std::chrono::duration<double>(now - m_start_host).count();
+    m_stats.speed         = m_stats.host_seconds > 0 ? m_stats.guest_seconds / m_stats.host_seconds : 0;
+    if (m_speed == 0) {
+        return;
+    }
+
+    const double due     = (double)(ticks - m_base_ticks) / (Intel8086::PIT_HZ * m_speed);
+    const double elapsed = std::chrono::duration<double>(now - m_base_host).count();
+    m_stats.lag_ms       = (elapsed - due) * 1000;
+    if (m_stats.lag_ms > m_stats.worst_lag_ms) {
+        m_stats.worst_lag_ms = m_stats.lag_ms;
+    }
+    if (due - elapsed > SLEEP_MIN) {
+        std::this_thread::sleep_until(m_base_host + std::chrono::duration_cast<Clock::duration>(
+                                                        std::chrono::duration<double>(due)));
+        ++m_stats.sleeps;
+    } else if (elapsed - due > MAX_LAG) {
+        m_base_host  = now;
+        m_base_ticks = ticks;
+        ++m_stats.resyncs;
+    }
+}
+Throttle::Stats Throttle::stats()
+{
+    return m_stats;
+}
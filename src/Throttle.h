@@ -0,0 +1,48 @@
+#pragma once
+#include <chrono>
+
+// Holds emulated time to the host clock. pace() is called between slices
+// with the PIT tick count; when the machine is ahead of real time by more
+// than SLEEP_MIN it sleeps until the host catches up. Targets are taken from
+// a fixed base, so rounding in individual sleeps does not accumulate.
+class Throttle {
+  public:
+    struct Stats
+    {
+        double    guest_seconds;    // emulated time since the base
+        double    host_seconds;     // host time since the base
+        double    speed;            // guest_seconds / host_seconds
+        double    lag_ms;           // host time behind schedule at the last pace()
+        double    worst_lag_ms;     // largest lag seen
+        long long sleeps;           // sleeps taken to wait for the host
+        long long resyncs;          // times it fell more than MAX_LAG behind
+    };
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    // Below this the slice is not worth a sleep; above MAX_LAG behind, the
+    // schedule restarts from now instead of running flat out to catch up.
+    static constexpr double SLEEP_MIN = 0.002;
+    static constexpr double MAX_LAG   = 0.1;
+
+    double m_speed    = 1.0;
+    bool   m_started  = false;
+    bool   m_counting = false;
+
+    // Schedule base, moved by set_speed() and resyncs, and start of the
+    // statistics.
+    Clock::time_point m_base_host;
+    long long         m_base_ticks = 0;
+    Clock::time_point m_start_host;
+    long long         m_start_ticks = 0;
+    Stats             m_stats{};
+
+  public:
+    // Multiple of the 4.77 MHz clock; 0 runs unthrottled.
+    void   set_speed(double multiple);
+    double speed();
+
+    void  pace(long long ticks);
+    Stats stats();
+};
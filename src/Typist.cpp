@@ -0,0 +1,186 @@
+#include "Typist.h"
+#include "Intel8086.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+// Printable characters on the XT keyboard, unshifted and shifted, from the
+// first scancode of each row.
+static const struct
+{
+    int         scancode;
+    const char *plain;
+    const char *shifted;
+} ROWS[] = {
+    {0x02, "1234567890-=", "!@#$%^&*()_+"},
+    {0x10, "qwertyuiop[]", "QWERTYUIOP{}"},
+    {0x1e, "asdfghjkl;'`", "ASDFGHJKL:\"~"},
+    {0x2b, "\\zxcvbnm,./", "|ZXCVBNM<>?"},
+};
+
+Typist::Typist(Intel8086 *cpu) : m_cpu(cpu)
+{
+}
+bool Typist::type(const std::string &text, Mode mode, int timeout_ms)
+{
+    const long long patience = (long long)timeout_ms * Intel8086::PIT_HZ / 1000;
+    const long long setup    = m_cpu->get_ticks() + (long long)SETUP_MS * Intel8086::PIT_HZ / 1000;
+    while (!bufferReady()) {
+        // Keys stored earlier would be wiped by the memory test.
+        if (!step(setup)) {
+            return false;
+        }
+    }
+    return mode == MODE_HLE ? typeBuffered(text, patience) : typeKeys(text, patience);
+}
+bool Typist::typeBuffered(const std::string &text, long long patience)
+{
+    long long deadline = m_cpu->get_ticks() + patience;
+    for (char c : text) {
+        while (bufferFull()) {
+            if (!step(deadline)) {
+                return false;
+            }
+        }
+        store(c);
+        deadline = m_cpu->get_ticks() + patience;
+    }
+    while (!bufferEmpty()) {
+        if (!step(deadline)) {
+            return false;
+        }
+    }
+    return true;
+}
+size_t Typist::feed(const std::string &text, size_t offset)
+{
+    if (!bufferReady()) {
+        return offset;
+    }
+    for (; offset < text.size() && !bufferFull(); ++offset) {
+        store(text[offset]);
+    }
+    return offset;
+}
+bool Typist::drained()
+{
+    return bufferEmpty();
+}
+bool Typist::typeKeys(const std::string &text, long long patience)
+{
+    for (char c : text) {
+        int  scancode, ascii;
+        bool shift;
+        lookup(c, scancode, ascii, shift);
+
+        int codes[4];
+        int count = 0;
+        if (shift) {
+            codes[count++] = SCAN_LSHIFT;
+        }
+        codes[count++] = scancode;
+        codes[count++] = scancode | 0x80;
+        if (shift) {
+            codes[count++] = SCAN_LSHIFT | 0x80;
+        }
+
+        const long long deadline = m_cpu->get_ticks() + patience;
+        for (int i = 0; i < count; ++i) {
+            while (!m_cpu->m_ppi->keyReady()) {
+                if (!step(deadline)) {
+                    return false;
+                }
+            }
+            m_cpu->m_ppi->keyTyped(codes[i]);
+        }
+        while (!m_cpu->m_ppi->keyReady() || !bufferEmpty()) {
+            if (!step(deadline)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+bool Typist::step(long long deadline)
+{
+    const long long ticks  = m_cpu->get_ticks();
+    const long long cycles = m_cpu->get_cycles();
+    if (ticks >= deadline) {
+        return false;
+    }
+    // A halted CPU skips ahead to its next interrupt, or to the deadline;
+    // one halted with interrupts disabled has nothing left to do.
+    m_cpu->run_until(deadline, cycles + SLICE);
+    return m_cpu->get_ticks() != ticks || m_cpu->get_cycles() != cycles;
+}
+void Typist::store(char c)
+{
+    int  scancode, ascii;
+    bool shift;
+    lookup(c, scancode, ascii, shift);
+    const int tail = readWord(BUFFER_TAIL);
+    const int next = tail + 2 == BUFFER_END ? BUFFER_START : tail + 2;
+    m_cpu->write_byte(0x400 + tail, ascii);
+    m_cpu->write_byte(0x400 + tail + 1, scancode);
+    m_cpu->write_byte(BUFFER_TAIL, next & 0xff);
+    m_cpu->write_byte(BUFFER_TAIL + 1, next >> 8);
+}
+int Typist::readWord(int addr)
+{
+    return m_cpu->read_byte(addr) | m_cpu->read_byte(addr + 1) << 8;
+}
+bool Typist::bufferReady()
+{
+    // Zero before POST, and test patterns during the memory test.
+    const int head = readWord(BUFFER_HEAD);
+    const int tail = readWord(BUFFER_TAIL);
+    return head >= BUFFER_START && head < BUFFER_END && (head & 1) == 0 && tail >= BUFFER_START &&
+           tail < BUFFER_END && (tail & 1) == 0;
+}
+bool Typist::bufferFull()
+{
+    const int tail = readWord(BUFFER_TAIL);
+    return (tail + 2 == BUFFER_END ? BUFFER_START : tail + 2) == readWord(BUFFER_HEAD);
+}
+bool Typist::bufferEmpty()
+{
+    return readWord(BUFFER_HEAD) == readWord(BUFFER_TAIL);
+}
+void Typist::lookup(char c, int &scancode, int &ascii, bool &shift)
+{
+    ascii = c == '\n' ? '\r' : (uint8_t)c;
+    shift = false;
+    switch (ascii) {
+        case 0x1b:
+            scancode = 0x01;
+            return;
+        case '\b':
+            scancode = 0x0e;
+            return;
+        case '\t':
+            scancode = 0x0f;
+            return;
+        case '\r':
+            scancode = 0x1c;
+            return;
+        case ' ':
+            scancode = 0x39;
+            return;
+    }
+    for (const auto &row : ROWS) {
+        if (ascii == 0) {
+            // strchr() would find the terminator.
+            break;
+        }
+        if (const char *p = strchr(row.plain, ascii)) {
+            scancode = row.scancode + (int)(p - row.plain);
+            return;
+        }
+        if (const char *p = strchr(row.shifted, ascii)) {
+            scancode = row.scancode + (int)(p - row.shifted);
+            shift    = true;
+            return;
+        }
+    }
+    throw std::runtime_error("Typist: no key types character " + std::to_string(ascii));
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <string>
+
+class Intel8086;
+
+// Types text into a machine as fast as the guest takes it, for feeding
+// programs and data to headless runs. Text is ASCII; newlines press Enter.
+class Typist {
+  public:
+    enum Mode
+    {
+        // Store characters straight into the BIOS keyboard buffer whenever it
+        // has room.
+        MODE_HLE,
+        // Press and release keys through the 8255, and wait for the guest to
+        // read each character before pressing the next. Assumes Caps Lock is
+        // off.
+        MODE_ACCURATE,
+    };
+
+  private:
+    // BIOS data area: ring of scancode and ASCII pairs and its offsets from
+    // segment 0x40.
+    static const int BUFFER_HEAD  = 0x41a;
+    static const int BUFFER_TAIL  = 0x41c;
+    static const int BUFFER_START = 0x1e;
+    static const int BUFFER_END   = 0x3e;
+
+    // Instructions run between two looks at the buffer.
+    static const int SLICE = 64;
+
+    // Emulated time allowed for POST to set up the buffer, in milliseconds.
+    static const int SETUP_MS = 30000;
+
+    static const int SCAN_LSHIFT = 0x2a;
+
+    Intel8086 *m_cpu;
+
+  public:
+    explicit Typist(Intel8086 *cpu);
+
+    // Returns once the guest has read all of text, or false if it took no
+    // key for timeout_ms of emulated time. Before POST has set up the BIOS
+    // keyboard buffer it first runs the machine until it has.
+    bool type(const std::string &text, Mode mode = MODE_HLE, int timeout_ms = 1000);
+
+    // For callers that run the machine themselves: stores characters of
+    // text from offset on into the BIOS keyboard buffer while it has room,
+    // and returns the offset of the first one left over, storing nothing
+    // until POST has set up the buffer. drained() tells when the guest has
+    // read them all.
+    size_t feed(const std::string &text, size_t offset = 0);
+    bool   drained();
+
+  private:
+    bool typeBuffered(const std::string &text, long long patience);
+    bool typeKeys(const std::string &text, long long patience);
+    bool step(long long deadline);
+    void store(char c);
+
+    int  readWord(int addr);
+    bool bufferReady();
+    bool bufferFull();
+    bool bufferEmpty();
+
+    static void lookup(char c, int &scancode, int &ascii, bool &shift);
+};
@@ -0,0 +1,259 @@
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include "Farm.h"
+#include "HostControl.h"
+#include "Machine.h"
+#include "Recorder.h"
+#include "TextScreen.h"
+#include "Typist.h"
+
+// Checks of the headless embedding API against the real BIOS and BASIC in
+// bin/. Each case boots its own machine; ctest runs them one at a time from
+// the source directory:
+//
+//   machine_test CASE
+
+#define CHECK(condition)                                                                                              \
+    do {                                                                                                              \
+        if (!(condition)) {                                                                                           \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                             \
+            return false;                                                                                             \
+        }                                                                                                             \
+    } while (0)
+
+// Emulated time allowed for the BASIC prompt to come up, in milliseconds.
+static const int BOOT_MS = 30000;
+
+static bool boot(TextScreen &screen)
+{
+    return screen.wait_for_text("Ok", TextScreen::Region{}, BOOT_MS);
+}
+static bool textScreen()
+{
+    Machine    machine;
+    TextScreen screen(machine.cpu());
+    CHECK(boot(screen));
+    CHECK(screen.columns() == 80);
+    CHECK(screen.text().find("The IBM Personal Computer Basic") == 0);
+
+    // Once BASIC waits for input the cursor sits below the prompt, and the
+    // search honours the region.
+    machine.run_for(100);
+    const int cursor = screen.cursor();
+    CHECK(cursor >= 0 && cursor % screen.columns() == 0);
+    const int row = cursor / screen.columns();
+    CHECK(screen.wait_for_text("Ok", TextScreen::Region{row - 1, 0, 1, 0}, 0));
+    CHECK(!screen.wait_for_text("Ok", TextScreen::Region{0, 0, row - 1, 0}, 0));
+    return true;
+}
+static bool typist()
+{
+    Machine    machine;
+    TextScreen screen(machine.cpu());
+    Typist     typist(machine.cpu());
+    CHECK(boot(screen));
+    CHECK(typist.type("PRINT 6*7\n"));
+    CHECK(screen.wait_for_text(" 42", TextScreen::Region{}, 1000));
+    CHECK(typist.type("PRINT \"a\";CHR$(65)\n", Typist::MODE_ACCURATE));
+    CHECK(screen.wait_for_text("aA", TextScreen::Region{}, 1000));
+    return true;
+}
+static bool farm()
+{
+    static const int       JOBS   = 3;
+    static const long long BUDGET = 100000;
+
+    Machine    base;
+    TextScreen prompt(base.cpu());
+    CHECK(boot(prompt));
+
+    // Forks of one booted machine: two programs that end, one that does not.
+    const char *programs[JOBS] = {"PRINT 6*7\n", "PRINT 2+2\n", "10 GOTO 10\nRUN\n"};
+    const char *answers[JOBS]  = {" 42", " 4", nullptr};
+
+    std::unique_ptr<Machine>    machines[JOBS];
+    std::unique_ptr<TextScreen> screens[JOBS];
+    Farm                        farm(2);
+    for (int i = 0; i < JOBS; ++i) {
+        machines[i] = base.fork();
+        screens[i].reset(new TextScreen(machines[i]->cpu()));
+        Typist typist(machines[i]->cpu());
+        CHECK(typist.feed(programs[i]) == strlen(programs[i]));
+
+        TextScreen *screen = screens[i].get();
+        const char *answer = answers[i];
+        farm.add(machines[i].get(),
+                 [screen, answer](Machine &) { return !answer || screen->text().find(answer) == std::string::npos; },
+                 answer ? LLONG_MAX : BUDGET);
+    }
+    farm.run();
+
+    for (int i = 0; i < JOBS; ++i) {
+        CHECK(farm.status(i) == (answers[i] ? Farm::STATUS_DONE : Farm::STATUS_BUDGET));
+    }
+    CHECK(farm.stats(JOBS - 1).instructions == BUDGET);
+
+    // The forks wrote to their own copies of the screen.
+    CHECK(prompt.text().find(" 42") == std::string::npos);
+    CHECK(screens[1]->text().find(" 42") == std::string::npos);
+    return true;
+}
+// Parks the CPU in STI; HLT; JMP $-3 at 0050:0000, so only the timer runs.
+static void halt(Machine &machine)
+{
+    static const uint8_t CODE[] = {0xfb, 0xf4, 0xeb, 0xfd};
+    machine.write_memory(0x500, CODE, sizeof(CODE));
+    machine.set_register(Intel8086::REG_CS, 0x50);
+    machine.set_register(Intel8086::REG_IP, 0);
+}
+static bool halted()
+{
+    Machine    skipped, stepped;
+    TextScreen skipped_screen(skipped.cpu()), stepped_screen(stepped.cpu());
+    CHECK(boot(skipped_screen));
+    CHECK(boot(stepped_screen));
+    halt(skipped);
+    halt(stepped);
+
+    // Skipping to each timer interrupt ends in the same state as ticking
+    // the halted CPU one PIT tick at a time.
+    const int       timer = skipped.read_byte(0x46c);
+    const long long end   = skipped.ticks() + 2 * Intel8086::PIT_HZ;
+    skipped.run_ticks(end - skipped.ticks());
+    while (stepped.ticks() < end) {
+        stepped.cpu()->run_step(1, false);
+    }
+    CHECK(skipped.ticks() == end && stepped.ticks() == end);
+    CHECK(skipped.instructions() == stepped.instructions());
+    CHECK(Recorder::fingerprint(skipped.cpu()) == Recorder::fingerprint(stepped.cpu()));
+
+    // The BIOS counted 18.2 timer interrupts a second meanwhile.
+    CHECK(((skipped.read_byte(0x46c) - timer) & 0xff) == 36);
+    CHECK(skipped.idle_ticks() > 0);
+
+    // Waiting on a halted guest skips from one timer interrupt to the next
+    // too: a minute of emulated time takes a moment. Stepping it one PIT tick
+    // at a time took seconds.
+    const auto      start = std::chrono::steady_clock::now();
+    const long long wait  = skipped.ticks();
+    CHECK(!skipped_screen.wait_for_text("NO SUCH TEXT", TextScreen::Region{}, 60000));
+    CHECK(skipped.ticks() - wait >= 60 * Intel8086::PIT_HZ);
+    Typist typist(skipped.cpu());
+    CHECK(!typist.type("x", Typist::MODE_HLE, 60000));
+    CHECK(skipped.ticks() - wait >= 120 * Intel8086::PIT_HZ);
+    CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+    return true;
+}
+static bool replayHalted()
+{
+    char path[] = "/tmp/machine_test_XXXXXX";
+    const int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    close(fd);
+
+    // Keys typed while the CPU is halted arrive at the same instruction
+    // count, a little apart in time, with and without a timer interrupt in
+    // between.
+    static const long long AT[]  = {5000, 9000, 90000};
+    static const int       KEY[] = {0x1e, 0x9e, 0x30};
+    uint64_t               end;
+    {
+        Machine    machine;
+        TextScreen screen(machine.cpu());
+        CHECK(boot(screen));
+        halt(machine);
+        machine.run_ticks(1000);
+        CHECK(machine.idle_ticks() > 0);
+
+        Intel8086      *cpu   = machine.cpu();
+        const long long start = cpu->get_ticks();
+        Recorder        recorder(cpu, path);
+        for (size_t i = 0; i < sizeof(AT) / sizeof(AT[0]); ++i) {
+            cpu->run_until(start + AT[i]);
+            CHECK(cpu->halted());
+            recorder.record(Recorder::EVENT_KEY, KEY[i]);
+            cpu->m_ppi->keyTyped(KEY[i]);
+        }
+        cpu->run_until(start + 200000);
+        end = Recorder::fingerprint(cpu);
+    }
+
+    Machine   machine;
+    Replayer  replayer(machine.cpu(), path);
+    Intel8086 *cpu = machine.cpu();
+    for (replayer.poll(); !replayer.finished(); replayer.poll()) {
+        long long tick_limit  = cpu->get_ticks() + 1000;
+        long long cycle_limit = LLONG_MAX;
+        replayer.limit(tick_limit, cycle_limit);
+        cpu->run_until(tick_limit, cycle_limit);
+    }
+    remove(path);
+    CHECK(!replayer.diverged());
+    CHECK(Recorder::fingerprint(cpu) == end);
+    return true;
+}
+static bool hostControl()
+{
+    Machine    machine;
+    TextScreen screen(machine.cpu());
+    Typist     typist(machine.cpu());
+
+    int                 status = -1;
+    HostControl::Region region{};
+    HostControl         host(machine.cpu(), [&status](int value) { status = value; });
+    host.setReport([&region](const HostControl::Region &report) { region = report; });
+    machine.cpu()->map_ports(&host, HostControl::PORT_FIRST, HostControl::PORT_LAST);
+
+    CHECK(boot(screen));
+    CHECK(typist.type("PRINT INP(&HE0)\n"));
+    CHECK(screen.wait_for_text(" 72", TextScreen::Region{}, 1000));
+
+    // Time a region, then exit with 3 << 8 | 5: only the low byte is a status.
+    CHECK(typist.type("OUT &HE2,9:OUT &HE0,1:FOR I=1 TO 10:NEXT:OUT &HE0,2:OUT &HE2,5:OUT &HE3,3:OUT &HE0,4\n"));
+    for (int i = 0; i < 100 && status < 0; ++i) {
+        machine.run_for(10);
+    }
+    CHECK(region.id == 9);
+    CHECK(region.instructions > 0 && region.cycles > region.instructions);
+    CHECK(status == 5);
+    return true;
+}
+
+static const struct
+{
+    const char *name;
+    bool (*run)();
+} CASES[] = {
+    {"text_screen", textScreen},
+    {"typist", typist},
+    {"farm", farm},
+    {"halted", halted},
+    {"replay_halted", replayHalted},
+    {"host_control", hostControl},
+};
+
+int main(int ArgCount, char **Args)
+{
+    if (ArgCount != 2) {
+        fputs("usage: machine_test CASE\n", stderr);
+        return EXIT_FAILURE;
+    }
+    for (const auto &test : CASES) {
+        if (strcmp(test.name, Args[1]) == 0) {
+            try {
+                return test.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+            } catch (const std::exception &e) {
+                fprintf(stderr, "%s: %s\n", test.name, e.what());
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    fprintf(stderr, "machine_test: no case %s\n", Args[1]);
+    return EXIT_FAILURE;
+}